@@ -0,0 +1,91 @@
+#ifndef AISDI_LINEAR_ALLOCATIONHOOKS_H
+#define AISDI_LINEAR_ALLOCATIONHOOKS_H
+
+/*
+ * Replaces global operator new and delete with versions feeding AllocationTracker.
+ * Include from exactly one translation unit of a program that wants allocation counts.
+ */
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "AllocationTracker.h"
+
+namespace aisdi {
+namespace detail {
+
+    // Every block is prefixed with its size, keeping the user part maximally aligned.
+    const std::size_t ALLOCATION_HEADER = alignof(std::max_align_t);
+
+    inline void* trackedAllocate(std::size_t pBytes) {
+        void* raw = std::malloc(pBytes + ALLOCATION_HEADER);
+        if (raw == nullptr)
+            return nullptr;
+        *static_cast<std::size_t*>(raw) = pBytes;
+        AllocationTracker::recordAllocation(pBytes);
+        return static_cast<char*>(raw) + ALLOCATION_HEADER;
+    }
+
+    inline void trackedFree(void* pMemory) {
+        if (pMemory == nullptr)
+            return;
+        void* raw = static_cast<char*>(pMemory) - ALLOCATION_HEADER;
+        AllocationTracker::recordDeallocation(*static_cast<std::size_t*>(raw));
+        std::free(raw);
+    }
+
+    struct AllocationHooksInstaller {
+        AllocationHooksInstaller() {
+            AllocationTracker::markInstalled();
+        }
+    };
+
+    static AllocationHooksInstaller allocationHooksInstaller;
+
+}
+}
+
+void* operator new(std::size_t pBytes) {
+    void* memory = aisdi::detail::trackedAllocate(pBytes);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void* operator new[](std::size_t pBytes) {
+    return operator new(pBytes);
+}
+
+void* operator new(std::size_t pBytes, const std::nothrow_t&) noexcept {
+    return aisdi::detail::trackedAllocate(pBytes);
+}
+
+void* operator new[](std::size_t pBytes, const std::nothrow_t&) noexcept {
+    return aisdi::detail::trackedAllocate(pBytes);
+}
+
+void operator delete(void* pMemory) noexcept {
+    aisdi::detail::trackedFree(pMemory);
+}
+
+void operator delete[](void* pMemory) noexcept {
+    aisdi::detail::trackedFree(pMemory);
+}
+
+void operator delete(void* pMemory, std::size_t) noexcept {
+    aisdi::detail::trackedFree(pMemory);
+}
+
+void operator delete[](void* pMemory, std::size_t) noexcept {
+    aisdi::detail::trackedFree(pMemory);
+}
+
+void operator delete(void* pMemory, const std::nothrow_t&) noexcept {
+    aisdi::detail::trackedFree(pMemory);
+}
+
+void operator delete[](void* pMemory, const std::nothrow_t&) noexcept {
+    aisdi::detail::trackedFree(pMemory);
+}
+
+#endif // AISDI_LINEAR_ALLOCATIONHOOKS_H
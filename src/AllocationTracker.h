@@ -0,0 +1,114 @@
+#ifndef AISDI_LINEAR_ALLOCATIONTRACKER_H
+#define AISDI_LINEAR_ALLOCATIONTRACKER_H
+
+#include <atomic>
+#include <cstddef>
+
+namespace aisdi {
+
+    struct AllocationStats {
+        std::size_t allocations;
+        std::size_t deallocations;
+        std::size_t allocatedBytes;
+        std::size_t liveBytes;
+        std::size_t peakBytes;
+    };
+
+    /*
+     * Process wide allocation counters. They only move once AllocationHooks.h, which replaces global
+     * operator new and delete, is compiled into the program; isInstalled() tells whether it was.
+     */
+    class AllocationTracker {
+    public:
+        static bool isInstalled() {
+            return state().installed.load(std::memory_order_relaxed);
+        }
+
+        static AllocationStats snapshot() {
+            State& s = state();
+            AllocationStats stats;
+            stats.allocations = s.allocations.load(std::memory_order_relaxed);
+            stats.deallocations = s.deallocations.load(std::memory_order_relaxed);
+            stats.allocatedBytes = s.allocatedBytes.load(std::memory_order_relaxed);
+            stats.liveBytes = s.liveBytes.load(std::memory_order_relaxed);
+            stats.peakBytes = s.peakBytes.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+        // Starts a new peak measurement from the current live bytes.
+        static void resetPeak() {
+            State& s = state();
+            s.peakBytes.store(s.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        static void recordAllocation(std::size_t pBytes) {
+            State& s = state();
+            s.allocations.fetch_add(1, std::memory_order_relaxed);
+            s.allocatedBytes.fetch_add(pBytes, std::memory_order_relaxed);
+            std::size_t live = s.liveBytes.fetch_add(pBytes, std::memory_order_relaxed) + pBytes;
+            std::size_t peak = s.peakBytes.load(std::memory_order_relaxed);
+            while (live > peak && !s.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) { }
+        }
+
+        static void recordDeallocation(std::size_t pBytes) {
+            State& s = state();
+            s.deallocations.fetch_add(1, std::memory_order_relaxed);
+            s.liveBytes.fetch_sub(pBytes, std::memory_order_relaxed);
+        }
+
+        static void markInstalled() {
+            state().installed.store(true, std::memory_order_relaxed);
+        }
+
+    private:
+        struct State {
+            std::atomic<std::size_t> allocations{0};
+            std::atomic<std::size_t> deallocations{0};
+            std::atomic<std::size_t> allocatedBytes{0};
+            std::atomic<std::size_t> liveBytes{0};
+            std::atomic<std::size_t> peakBytes{0};
+            std::atomic<bool> installed{false};
+        };
+
+        static State& state() {
+            static State s;
+            return s;
+        }
+    };
+
+    struct AllocationDelta {
+        std::size_t allocations;
+        std::size_t deallocations;
+        std::size_t allocatedBytes;
+        std::ptrdiff_t liveBytes;  // change of live bytes, negative when memory was released
+        std::size_t peakBytes;     // highest live bytes above the starting point
+    };
+
+    /*
+     * Counts allocations made between construction and delta(). The peak is tracked globally,
+     * so a nested scope restarts the peak measurement of the outer one.
+     */
+    class AllocationScope {
+    public:
+        AllocationScope() : mStart(AllocationTracker::snapshot()) {
+            AllocationTracker::resetPeak();
+        }
+
+        AllocationDelta delta() const {
+            AllocationStats now = AllocationTracker::snapshot();
+            AllocationDelta delta;
+            delta.allocations = now.allocations - mStart.allocations;
+            delta.deallocations = now.deallocations - mStart.deallocations;
+            delta.allocatedBytes = now.allocatedBytes - mStart.allocatedBytes;
+            delta.liveBytes = static_cast<std::ptrdiff_t>(now.liveBytes) - static_cast<std::ptrdiff_t>(mStart.liveBytes);
+            delta.peakBytes = now.peakBytes > mStart.liveBytes ? now.peakBytes - mStart.liveBytes : 0;
+            return delta;
+        }
+
+    private:
+        AllocationStats mStart;
+    };
+
+}
+
+#endif // AISDI_LINEAR_ALLOCATIONTRACKER_H
@@ -0,0 +1,472 @@
+#ifndef AISDI_LINEAR_ARRAYLIST_H
+#define AISDI_LINEAR_ARRAYLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi {
+
+    /*
+     * Doubly linked list whose nodes live in one growable array and link to each other by 32-bit
+     * slot indices. Erased slots are chained into a free list and reused by later inserts.
+     *
+     * Iterators hold slot indices, so unlike Vector they stay valid when the array grows;
+     * like LinkedList, only erasing an element invalidates iterators to it. The array holds no
+     * pointers, so after compact() a list of trivially copyable elements is one relocatable block.
+     */
+    template<typename Type>
+    class ArrayList {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type*;
+        using reference = Type&;
+        using const_pointer = const Type*;
+        using const_reference = const Type&;
+
+        class ConstIterator;
+
+        friend class ConstIterator;
+
+        class Iterator;
+
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        using Index = std::uint32_t;
+
+        struct Link;
+        struct Slot;
+
+        static const std::size_t INIT_CAPACITY = 16;
+
+        // The end sentinel is a member, so empty and moved-from lists own no memory.
+        ArrayList() noexcept : mEnd{END, END}, mSlots(nullptr), mCapacity(0), mUsed(0), mCount(0), mFree(END) { }
+
+        ArrayList(std::initializer_list<Type> l) : ArrayList() {
+            assign(l.begin(), l.end());
+        }
+
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        ArrayList(InputIt first, InputIt last) : ArrayList() {
+            assign(first, last);
+        }
+
+        ArrayList(const ArrayList& other) : ArrayList() {
+            assign(other.cbegin(), other.cend());
+        }
+
+        ArrayList(ArrayList&& other) noexcept : ArrayList() {
+            swap(other);
+        }
+
+        ~ArrayList() {
+            clear();
+            ::operator delete(mSlots);
+        }
+
+        ArrayList& operator=(const ArrayList& other) {
+            if (this != &other)
+                assign(other.cbegin(), other.cend());
+            return *this;
+        }
+
+        ArrayList& operator=(ArrayList&& other) noexcept {
+            if (this != &other) {
+                ArrayList moved(std::move(other));
+                swap(moved);
+            }
+            return *this;
+        }
+
+        void swap(ArrayList& other) noexcept {
+            std::swap(mEnd, other.mEnd);
+            std::swap(mSlots, other.mSlots);
+            std::swap(mCapacity, other.mCapacity);
+            std::swap(mUsed, other.mUsed);
+            std::swap(mCount, other.mCount);
+            std::swap(mFree, other.mFree);
+        }
+
+        /*
+         * Replaces the contents with [first, last), which must not point into this list.
+         * The array is kept when large enough, elements of a forward range take one allocation otherwise.
+         */
+        template<typename InputIt>
+        void assign(InputIt first, InputIt last) {
+            clear();
+            reserve_range(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+            for (; first != last; ++first)
+                insert_before(END, *first);
+        }
+
+        bool isEmpty() const {
+            return mCount == 0;
+        }
+
+        size_type getSize() const {
+            return mCount;
+        }
+
+        void append(const Type& item) {
+            insert_before(END, item);
+        }
+
+        void append(Type&& item) {
+            insert_before(END, std::move(item));
+        }
+
+        void prepend(const Type& item) {
+            insert_before(mEnd.next, item);
+        }
+
+        void prepend(Type&& item) {
+            insert_before(mEnd.next, std::move(item));
+        }
+
+        void insert(const const_iterator& insertPosition, const Type& item) {
+            insert_before(insertPosition.mIndex, item);
+        }
+
+        void insert(const const_iterator& insertPosition, Type&& item) {
+            insert_before(insertPosition.mIndex, std::move(item));
+        }
+
+        Type popFirst() {
+            if (mCount == 0)
+                throw std::out_of_range("Popping from empty list");
+            Type ret = std::move(value(mEnd.next));
+            release(mEnd.next);
+            return ret;
+        }
+
+        Type popLast() {
+            if (mCount == 0)
+                throw std::out_of_range("Popping from empty list");
+            Type ret = std::move(value(mEnd.prev));
+            release(mEnd.prev);
+            return ret;
+        }
+
+        void erase(const const_iterator& possition) {
+            if (possition.mIndex == END)
+                throw std::out_of_range("Removing end of list");
+            release(possition.mIndex);
+        }
+
+        void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded) {
+            Index index = firstIncluded.mIndex;
+            while (index != lastExcluded.mIndex) {
+                Index next = link(index).next;
+                release(index);
+                index = next;
+            }
+        }
+
+        /*
+         * Moves the elements to slots 0..size-1 in list order and frees unused capacity,
+         * restoring sequential access after churn. Invalidates all iterators.
+         */
+        void compact() {
+            Slot* slots = allocate(mCount);
+            Index target = 0;
+            for (Index index = mEnd.next; index != END; index = link(index).next, ++target) {
+                new(&slots[target].storage) Type(std::move(value(index)));
+                slots[target].link = Link{target == 0 ? END : target - 1, target + 1};
+            }
+            clear();
+            ::operator delete(mSlots);
+            mSlots = slots;
+            mCapacity = mCount = mUsed = target;
+            if (target > 0) {
+                slots[target - 1].link.next = END;
+                mEnd = Link{target - 1, 0};
+            }
+        }
+
+        iterator begin() {
+            return Iterator(*this, mEnd.next);
+        }
+
+        iterator end() {
+            return Iterator(*this, END);
+        }
+
+        const_iterator cbegin() const {
+            return ConstIterator(*this, mEnd.next);
+        }
+
+        const_iterator cend() const {
+            return ConstIterator(*this, END);
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+    private:
+        // Index of the end sentinel, never a slot.
+        static const Index END = 0xFFFFFFFF;
+
+        Link mEnd;
+        Slot* mSlots;
+        std::size_t mCapacity;
+        std::size_t mUsed;     // slots at or above mUsed have never been handed out
+        std::size_t mCount;
+        Index mFree;           // erased slots, chained through link.next
+
+        static Slot* allocate(std::size_t pCapacity) {
+            if (pCapacity == 0)
+                return nullptr;
+            return static_cast<Slot*>(::operator new(pCapacity * sizeof(Slot)));
+        }
+
+        Link& link(Index pIndex) {
+            return pIndex == END ? mEnd : mSlots[pIndex].link;
+        }
+
+        const Link& link(Index pIndex) const {
+            return pIndex == END ? mEnd : mSlots[pIndex].link;
+        }
+
+        Type& value(Index pIndex) const {
+            return *reinterpret_cast<Type*>(&mSlots[pIndex].storage);
+        }
+
+        // Grows to pCapacity slots, moving live elements to the same indices.
+        void realocate(std::size_t pCapacity) {
+            Slot* slots = allocate(pCapacity);
+            for (std::size_t idx = 0; idx < mUsed; ++idx)
+                slots[idx].link = mSlots[idx].link;
+            for (Index index = mEnd.next; index != END; index = mSlots[index].link.next) {
+                new(&slots[index].storage) Type(std::move(value(index)));
+                value(index).~Type();
+            }
+            ::operator delete(mSlots);
+            mSlots = slots;
+            mCapacity = pCapacity;
+        }
+
+        template<typename ForwardIt>
+        void reserve_range(ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+            std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+            if (count > mCapacity)
+                realocate(count);
+        }
+
+        template<typename InputIt>
+        void reserve_range(InputIt, InputIt, std::input_iterator_tag) { }
+
+        Index acquire() {
+            if (mFree != END) {
+                Index index = mFree;
+                mFree = mSlots[index].link.next;
+                return index;
+            }
+            if (mUsed == mCapacity) {
+                if (mCapacity >= END)
+                    throw std::length_error("ArrayList can not hold more elements");
+                std::size_t capacity = mCapacity * 2;
+                if (capacity < INIT_CAPACITY)
+                    capacity = INIT_CAPACITY;
+                if (capacity > END)
+                    capacity = END;
+                realocate(capacity);
+            }
+            return static_cast<Index>(mUsed++);
+        }
+
+        template<typename Value>
+        void insert_before(Index pBefore, Value&& pItem) {
+            Index index = acquire();
+            try {
+                new(&mSlots[index].storage) Type(std::forward<Value>(pItem));
+            }
+            catch (...) {
+                mSlots[index].link.next = mFree;
+                mFree = index;
+                throw;
+            }
+            Link& before = link(pBefore);
+            mSlots[index].link = Link{before.prev, pBefore};
+            link(before.prev).next = index;
+            before.prev = index;
+            ++mCount;
+        }
+
+        void release(Index pIndex) {
+            Link& node = mSlots[pIndex].link;
+            link(node.prev).next = node.next;
+            link(node.next).prev = node.prev;
+            value(pIndex).~Type();
+            node.next = mFree;
+            mFree = pIndex;
+            --mCount;
+        }
+
+        // Destroys all elements, keeping the array.
+        void clear() {
+            for (Index index = mEnd.next; index != END; index = mSlots[index].link.next)
+                value(index).~Type();
+            mEnd = Link{END, END};
+            mUsed = 0;
+            mCount = 0;
+            mFree = END;
+        }
+    };
+
+    template<typename Type>
+    const std::size_t ArrayList<Type>::INIT_CAPACITY;
+
+    template<typename Type>
+    const typename ArrayList<Type>::Index ArrayList<Type>::END;
+
+    template<typename Type>
+    struct ArrayList<Type>::Link {
+        Index prev;
+        Index next;
+    };
+
+    template<typename Type>
+    struct ArrayList<Type>::Slot {
+        Link link;
+        typename std::aligned_storage<sizeof(Type), alignof(Type)>::type storage;
+    };
+
+    template<typename Type>
+    class ArrayList<Type>::ConstIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename ArrayList::value_type;
+        using difference_type = typename ArrayList::difference_type;
+        using pointer = typename ArrayList::const_pointer;
+        using reference = typename ArrayList::const_reference;
+
+        friend class ArrayList<Type>;
+
+        explicit ConstIterator(const ArrayList& pList, Index pIndex) : mList(pList), mIndex(pIndex) { }
+
+        reference operator*() const {
+            if (mIndex == END)
+                throw std::out_of_range("Dereferencing invalid iterator");
+            return mList.value(mIndex);
+        }
+
+        ConstIterator& operator++() {
+            if (mIndex == END)
+                throw std::out_of_range("Trying to increment end iterator");
+            mIndex = mList.link(mIndex).next;
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator copy(*this);
+            operator++();
+            return copy;
+        }
+
+        ConstIterator& operator--() {
+            if (mList.link(mIndex).prev == END)
+                throw std::out_of_range("Trying to decrement begin iterator");
+            mIndex = mList.link(mIndex).prev;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            ConstIterator copy(*this);
+            operator--();
+            return copy;
+        }
+
+        // Stops at end() when the list is shorter than d.
+        ConstIterator operator+(difference_type d) const {
+            Index index = mIndex;
+            for (difference_type offset = 0; index != END && offset < d; ++offset)
+                index = mList.link(index).next;
+            return ConstIterator(mList, index);
+        }
+
+        // Stepping back past the first element also gives end(), which can not be dereferenced.
+        ConstIterator operator-(difference_type d) const {
+            Index index = mIndex;
+            for (difference_type offset = 0; offset < d; ++offset) {
+                index = mList.link(index).prev;
+                if (index == END)
+                    break;
+            }
+            return ConstIterator(mList, index);
+        }
+
+        bool operator==(const ConstIterator& other) const {
+            return mIndex == other.mIndex;
+        }
+
+        bool operator!=(const ConstIterator& other) const {
+            return !operator==(other);
+        }
+
+    protected:
+        const ArrayList& mList;
+        Index mIndex;
+    };
+
+    template<typename Type>
+    class ArrayList<Type>::Iterator : public ArrayList<Type>::ConstIterator {
+    public:
+        using pointer = typename ArrayList::pointer;
+        using reference = typename ArrayList::reference;
+
+        explicit Iterator(const ArrayList& pList, Index pIndex) : ConstIterator(pList, pIndex) { }
+
+        Iterator(const ConstIterator& other) : ConstIterator(other) { }
+
+        Iterator& operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator& operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        reference operator*() const {
+            // ugly cast, yet reduces code duplication.
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_ARRAYLIST_H
@@ -0,0 +1,518 @@
+#ifndef AISDI_LINEAR_BENCHMARK_H
+#define AISDI_LINEAR_BENCHMARK_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+#include "AllocationTracker.h"
+#include "PerfCounters.h"
+
+namespace aisdi {
+namespace bench {
+
+    // Forces the compiler to materialize value, so the computation producing it is not optimized away.
+    template<typename Type>
+    inline void doNotOptimize(const Type& value) {
+        __asm__ __volatile__("" : : "r,m"(value) : "memory");
+    }
+
+    // Forces pending writes to memory to be treated as observable.
+    inline void clobberMemory() {
+        __asm__ __volatile__("" : : : "memory");
+    }
+
+    struct Statistics {
+        double mean;
+        double median;
+        double p95;
+        double stddev;
+        double min;
+    };
+
+    // Samples are taken by value, they get sorted.
+    inline Statistics summarize(std::vector<double> pSamples) {
+        Statistics stats = {0, 0, 0, 0, 0};
+        if (pSamples.empty())
+            return stats;
+
+        std::sort(pSamples.begin(), pSamples.end());
+        std::size_t count = pSamples.size();
+        double sum = 0;
+        for (double sample : pSamples)
+            sum += sample;
+        stats.mean = sum / count;
+        stats.median = count % 2 == 1 ? pSamples[count / 2] : (pSamples[count / 2 - 1] + pSamples[count / 2]) / 2;
+        stats.p95 = pSamples[std::min(count - 1, static_cast<std::size_t>(std::ceil(0.95 * count)) - 1)];
+        double squares = 0;
+        for (double sample : pSamples)
+            squares += (sample - stats.mean) * (sample - stats.mean);
+        stats.stddev = count > 1 ? std::sqrt(squares / (count - 1)) : 0;
+        stats.min = pSamples.front();
+        return stats;
+    }
+
+    struct CacheSizes {
+        std::size_t l1;
+        std::size_t l2;
+        std::size_t l3;
+    };
+
+    // Data cache sizes in bytes as reported by the C library, common desktop sizes where it does not know.
+    inline CacheSizes cacheSizes() {
+        CacheSizes sizes = {32 * 1024, 1024 * 1024, 32 * 1024 * 1024};
+#ifdef _SC_LEVEL1_DCACHE_SIZE
+        long l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+        long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (l1 > 0)
+            sizes.l1 = static_cast<std::size_t>(l1);
+        if (l2 > 0)
+            sizes.l2 = static_cast<std::size_t>(l2);
+        if (l3 > 0)
+            sizes.l3 = static_cast<std::size_t>(l3);
+#endif
+        return sizes;
+    }
+
+    /*
+     * Element counts whose footprint is half of L1, half of L2, half of L3 and four times L3.
+     * Last level caches above 32 MiB are treated as 32 MiB, keeping the DRAM point affordable.
+     */
+    inline std::vector<std::size_t> workingSetSizes(std::size_t pBytesPerElement) {
+        CacheSizes caches = cacheSizes();
+        std::size_t l3 = std::min<std::size_t>(caches.l3, 32 * 1024 * 1024);
+        std::size_t bytes[] = {caches.l1 / 2, caches.l2 / 2, l3 / 2, l3 * 4};
+        std::vector<std::size_t> sizes;
+        for (std::size_t workingSet : bytes)
+            sizes.push_back(std::max<std::size_t>(1, workingSet / pBytesPerElement));
+        return sizes;
+    }
+
+    struct Options {
+        std::size_t warmup = 1;
+        std::size_t repetitions = 5;
+        std::string benchmarkFilter;
+        std::string containerFilter;
+        std::string typeFilter;
+        std::vector<std::size_t> sizes;
+        std::size_t threads = 0; // 0 runs single threaded, N runs scaling scenarios on 1..N threads
+        std::string jsonPath;
+        std::string baselinePath;
+        std::string tracePath;
+        double threshold = 0.10;
+        bool perfCounters = false;
+        bool large = false;      // adds sizes whose data takes a gigabyte or more
+    };
+
+    inline std::vector<std::size_t> parseSizes(const std::string& pList) {
+        std::vector<std::size_t> sizes;
+        std::size_t begin = 0;
+        while (begin < pList.size()) {
+            std::size_t end = pList.find(',', begin);
+            if (end == std::string::npos)
+                end = pList.size();
+            sizes.push_back(std::stoul(pList.substr(begin, end - begin)));
+            begin = end + 1;
+        }
+        return sizes;
+    }
+
+    inline const char* usage() {
+        return "usage: aisdiLinearBench [--benchmark=NAME] [--container=NAME] [--type=NAME] [--size=N[,N...]]\n"
+               "                        [--repetitions=N] [--warmup=N] [--threads=N] [--json=FILE]\n"
+               "                        [--baseline=FILE [--threshold=FRACTION]] [--trace=FILE] [--perf]\n"
+               "                        [--large]\n"
+               "  NAME filters are substrings, sizes must match exactly.\n"
+               "  --json writes results, --baseline reruns the benchmarks stored in FILE and exits\n"
+               "  with failure when any of them got significantly slower than THRESHOLD (default 0.10)\n"
+               "  or did not run.\n"
+               "  --threads runs Append, Prepend, PopFirst and RandomInsert on 1..N threads at once, each\n"
+               "  with its own collection, and reports per thread throughput and scaling efficiency.\n"
+               "  --trace replays a recorded operation trace (OperationTrace.h) instead of the synthetic\n"
+               "  benchmarks and adds per operation latencies.\n"
+               "  --perf adds per operation hardware counters (Linux perf_event_open) when available.\n"
+               "  --large adds the 100M element sorts and 10M record stable sorts, over a gigabyte each.\n"
+               "  Builds with AISDI_BENCH_ALLOCATIONS=ON also report allocations and bytes per operation.\n";
+    }
+
+    // Throws std::invalid_argument on unknown options.
+    inline Options parseOptions(int argc, char** argv) {
+        Options options;
+        for (int idx = 1; idx < argc; ++idx) {
+            std::string arg = argv[idx];
+            std::size_t eq = arg.find('=');
+            std::string key = arg.substr(0, eq);
+            std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+            if (key == "--benchmark")
+                options.benchmarkFilter = value;
+            else if (key == "--container")
+                options.containerFilter = value;
+            else if (key == "--type")
+                options.typeFilter = value;
+            else if (key == "--size")
+                options.sizes = parseSizes(value);
+            else if (key == "--repetitions")
+                options.repetitions = std::max<std::size_t>(1, std::stoul(value));
+            else if (key == "--warmup")
+                options.warmup = std::stoul(value);
+            else if (key == "--threads")
+                options.threads = std::stoul(value);
+            else if (key == "--json")
+                options.jsonPath = value;
+            else if (key == "--baseline")
+                options.baselinePath = value;
+            else if (key == "--trace")
+                options.tracePath = value;
+            else if (key == "--threshold")
+                options.threshold = std::stod(value);
+            else if (key == "--perf")
+                options.perfCounters = true;
+            else if (key == "--large")
+                options.large = true;
+            else
+                throw std::invalid_argument("Unknown option " + arg);
+        }
+        return options;
+    }
+
+    struct Result {
+        std::string benchmark;
+        std::string container;
+        std::string type;
+        std::size_t size;
+        std::size_t threads = 0;     // 0 for single threaded runs, otherwise concurrently running copies
+        std::vector<double> samples; // nanoseconds per repetition, wall time of all threads when threaded
+        Statistics stats;
+        std::vector<std::pair<std::string, double>> counters; // per operation, median over repetitions
+    };
+
+    /*
+     * Runs benchmarks selected by Options. Every repetition calls setup(size) untimed to build a fixture,
+     * then times only measure(fixture, size).
+     */
+    class Runner {
+    public:
+        explicit Runner(const Options& pOptions) : mOptions(pOptions) {
+            if (mOptions.perfCounters)
+                mPerf.reset(new PerfCounters);
+        }
+
+        bool hasPerfCounters() const {
+            return mPerf && mPerf->isAvailable();
+        }
+
+        // Always single threaded, also with --threads.
+        template<typename Setup, typename Measure>
+        void run(const std::string& pBenchmark, const std::string& pContainer, const std::string& pType,
+                 const std::vector<std::size_t>& pSizes, Setup setup, Measure measure) {
+            for (std::size_t size : pSizes)
+                if (isSelected(pBenchmark, pContainer, pType, size, 0))
+                    runOne(pBenchmark, pContainer, pType, size, setup, measure);
+        }
+
+        /*
+         * For scenarios where each thread works on its own collection: with --threads=N the single
+         * threaded run is replaced by runs on 1..N threads at once. Scenarios that start threads
+         * themselves belong in run().
+         */
+        template<typename Setup, typename Measure>
+        void runScaling(const std::string& pBenchmark, const std::string& pContainer, const std::string& pType,
+                        const std::vector<std::size_t>& pSizes, Setup setup, Measure measure) {
+            std::size_t maxThreads = mOptions.threads;
+            for (const Result& result : mOnly)
+                maxThreads = std::max(maxThreads, result.threads);
+
+            // Threaded runs replace the single threaded one, unless restrictTo() asks for it.
+            bool single = mOptions.threads == 0 || !mOnly.empty();
+            for (std::size_t size : pSizes) {
+                if (single && isSelected(pBenchmark, pContainer, pType, size, 0))
+                    runOne(pBenchmark, pContainer, pType, size, setup, measure);
+                for (std::size_t threads = 1; threads <= maxThreads; ++threads)
+                    if (isSelected(pBenchmark, pContainer, pType, size, threads))
+                        runThreaded(pBenchmark, pContainer, pType, size, threads, setup, measure);
+            }
+        }
+
+        // Only benchmark, container, type, size and thread count combinations present in pResults will run.
+        void restrictTo(const std::vector<Result>& pResults) {
+            mOnly = pResults;
+        }
+
+        const std::vector<Result>& getResults() const {
+            return mResults;
+        }
+
+        // Prints one table per element type, in the order types were first run.
+        void report(std::ostream& out) const {
+            std::vector<std::string> types;
+            bool threaded = false;
+            for (const Result& result : mResults) {
+                if (std::find(types.begin(), types.end(), result.type) == types.end())
+                    types.push_back(result.type);
+                threaded = threaded || result.threads > 0;
+            }
+
+            for (const std::string& type : types) {
+                // Threaded and single threaded results carry different counters; rows leave missing ones blank.
+                std::vector<std::string> counterNames;
+                for (const Result& result : mResults) {
+                    if (result.type != type)
+                        continue;
+                    for (auto& counter : result.counters)
+                        if (std::find(counterNames.begin(), counterNames.end(), counter.first) == counterNames.end())
+                            counterNames.push_back(counter.first);
+                }
+
+                out << (&type == &types.front() ? "" : "\n") << "== " << type << " ==\n";
+                out << std::left << std::setw(16) << "benchmark" << std::setw(18) << "container"
+                    << std::right << std::setw(10) << "size";
+                if (threaded)
+                    out << std::setw(8) << "threads";
+                out << std::setw(14) << "median[ns]"
+                    << std::setw(14) << "p95[ns]" << std::setw(12) << "stddev[ns]" << std::setw(12) << "ns/op";
+                for (const std::string& name : counterNames)
+                    out << std::setw(15) << name + "/op";
+                out << '\n';
+                for (const Result& result : mResults) {
+                    if (result.type != type)
+                        continue;
+                    out << std::left << std::setw(16) << result.benchmark << std::setw(18) << result.container
+                        << std::right << std::setw(10) << result.size;
+                    if (threaded)
+                        out << std::setw(8) << result.threads;
+                    out << std::fixed << std::setprecision(0)
+                        << std::setw(14) << result.stats.median << std::setw(14) << result.stats.p95
+                        << std::setw(12) << result.stats.stddev
+                        << std::setprecision(2) << std::setw(12)
+                        << result.stats.median / std::max<std::size_t>(1, result.size);
+                    for (const std::string& name : counterNames) {
+                        auto counter = std::find_if(result.counters.begin(), result.counters.end(),
+                                                    [&](const std::pair<std::string, double>& pCounter) {
+                                                        return pCounter.first == name;
+                                                    });
+                        if (counter != result.counters.end())
+                            out << std::setw(15) << counter->second;
+                        else
+                            out << std::setw(15) << "";
+                    }
+                    out << '\n';
+                }
+            }
+        }
+
+        /*
+         * For threaded results: throughput of a single thread, of all threads together, and scaling
+         * efficiency, the total throughput relative to thread count times the one thread throughput.
+         */
+        void reportScaling(std::ostream& out) const {
+            out << std::left << std::setw(16) << "benchmark" << std::setw(18) << "container" << std::setw(16) << "type"
+                << std::right << std::setw(10) << "size" << std::setw(8) << "threads"
+                << std::setw(18) << "thread[Mops/s]" << std::setw(16) << "total[Mops/s]"
+                << std::setw(12) << "efficiency" << '\n';
+            for (const Result& result : mResults) {
+                if (result.threads == 0)
+                    continue;
+                auto single = std::find_if(mResults.begin(), mResults.end(), [&](const Result& other) {
+                    return other.benchmark == result.benchmark && other.container == result.container
+                           && other.type == result.type && other.size == result.size && other.threads == 1;
+                });
+                double total = totalThroughput(result);
+                out << std::left << std::setw(16) << result.benchmark << std::setw(18) << result.container
+                    << std::setw(16) << result.type << std::right << std::setw(10) << result.size
+                    << std::setw(8) << result.threads << std::fixed << std::setprecision(2)
+                    << std::setw(18) << 1e3 / std::max(1e-9, result.counters.front().second)
+                    << std::setw(16) << total;
+                if (single != mResults.end())
+                    out << std::setw(11) << 100 * total / (result.threads * totalThroughput(*single)) << '%';
+                out << '\n';
+            }
+        }
+
+    private:
+        Options mOptions;
+        std::vector<Result> mResults;
+        std::vector<Result> mOnly;
+        std::unique_ptr<PerfCounters> mPerf;
+
+        // Operations of all threads per microsecond of wall time.
+        static double totalThroughput(const Result& pResult) {
+            return pResult.size * pResult.threads * 1e3 / std::max(1.0, pResult.stats.median);
+        }
+
+        bool isSelected(const std::string& pBenchmark, const std::string& pContainer, const std::string& pType,
+                        std::size_t pSize, std::size_t pThreads) const {
+            if (!mOnly.empty() && std::none_of(mOnly.begin(), mOnly.end(), [&](const Result& result) {
+                return result.benchmark == pBenchmark && result.container == pContainer && result.type == pType
+                       && result.size == pSize && result.threads == pThreads;
+            }))
+                return false;
+            if (mOnly.empty() && pThreads > 0 && mOptions.threads == 0)
+                return false;
+            if (pType.find(mOptions.typeFilter) == std::string::npos)
+                return false;
+            if (pBenchmark.find(mOptions.benchmarkFilter) == std::string::npos)
+                return false;
+            if (pContainer.find(mOptions.containerFilter) == std::string::npos)
+                return false;
+            return mOptions.sizes.empty()
+                   || std::find(mOptions.sizes.begin(), mOptions.sizes.end(), pSize) != mOptions.sizes.end();
+        }
+
+        template<typename Setup, typename Measure>
+        void runOne(const std::string& pBenchmark, const std::string& pContainer, const std::string& pType,
+                    std::size_t pSize, Setup& setup, Measure& measure) {
+            using Clock = std::chrono::steady_clock;
+
+            for (std::size_t idx = 0; idx < mOptions.warmup; ++idx) {
+                auto fixture = setup(pSize);
+                measure(fixture, pSize);
+                clobberMemory();
+            }
+
+            Result result;
+            result.benchmark = pBenchmark;
+            result.container = pContainer;
+            result.type = pType;
+            result.size = pSize;
+            bool counting = hasPerfCounters();
+            bool tracking = AllocationTracker::isInstalled();
+            std::vector<std::string> names;
+            if (counting)
+                names = mPerf->getNames();
+            if (tracking)
+                names.insert(names.end(), {"allocs", "alloc-bytes", "live-bytes", "peak-bytes"});
+
+            std::vector<std::vector<double>> counts;
+            for (std::size_t idx = 0; idx < mOptions.repetitions; ++idx) {
+                auto fixture = setup(pSize);
+                clobberMemory();
+                AllocationScope allocations;
+                if (counting)
+                    mPerf->start();
+                Clock::time_point start = Clock::now();
+                measure(fixture, pSize);
+                clobberMemory();
+                Clock::time_point stop = Clock::now();
+                std::vector<double> values;
+                if (counting)
+                    values = mPerf->stop();
+                if (tracking) {
+                    AllocationDelta delta = allocations.delta();
+                    values.insert(values.end(), {static_cast<double>(delta.allocations),
+                                                 static_cast<double>(delta.allocatedBytes),
+                                                 static_cast<double>(delta.liveBytes),
+                                                 static_cast<double>(delta.peakBytes)});
+                }
+                counts.push_back(values);
+                result.samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+            }
+            result.stats = summarize(result.samples);
+            for (std::size_t counter = 0; counter < names.size(); ++counter) {
+                std::vector<double> values;
+                for (auto& repetition : counts)
+                    values.push_back(repetition[counter]);
+                result.counters.emplace_back(names[counter],
+                                             summarize(values).median / std::max<std::size_t>(1, pSize));
+            }
+            mResults.push_back(result);
+        }
+
+        /*
+         * Every thread builds its own fixture, then all of them start measure() together. Samples are the
+         * wall time until the last thread finishes; "thread-ns" is the time of a single thread. Fixtures
+         * are destroyed only after all threads finished, so teardown does not overlap with measurement.
+         * Hardware counters only see the calling thread and are not collected here.
+         */
+        template<typename Setup, typename Measure>
+        void runThreaded(const std::string& pBenchmark, const std::string& pContainer, const std::string& pType,
+                         std::size_t pSize, std::size_t pThreads, Setup& setup, Measure& measure) {
+            using Clock = std::chrono::steady_clock;
+
+            Result result;
+            result.benchmark = pBenchmark;
+            result.container = pContainer;
+            result.type = pType;
+            result.size = pSize;
+            result.threads = pThreads;
+            bool tracking = AllocationTracker::isInstalled();
+
+            std::vector<double> threadSamples;
+            std::vector<std::vector<double>> counts;
+            for (std::size_t idx = 0; idx < mOptions.warmup + mOptions.repetitions; ++idx) {
+                std::atomic<std::size_t> ready(0);
+                std::atomic<std::size_t> finished(0);
+                std::atomic<bool> started(false);
+                std::atomic<bool> released(false);
+                std::vector<double> elapsed(pThreads);
+                std::vector<std::thread> workers;
+                for (std::size_t thread = 0; thread < pThreads; ++thread) {
+                    workers.emplace_back([&, thread]() {
+                        auto fixture = setup(pSize);
+                        ready.fetch_add(1, std::memory_order_acq_rel);
+                        while (!started.load(std::memory_order_acquire))
+                            std::this_thread::yield();
+                        Clock::time_point start = Clock::now();
+                        measure(fixture, pSize);
+                        clobberMemory();
+                        elapsed[thread] = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+                        finished.fetch_add(1, std::memory_order_acq_rel);
+                        while (!released.load(std::memory_order_acquire))
+                            std::this_thread::yield();
+                    });
+                }
+
+                while (ready.load(std::memory_order_acquire) < pThreads)
+                    std::this_thread::yield();
+                AllocationScope allocations;
+                Clock::time_point start = Clock::now();
+                started.store(true, std::memory_order_release);
+                while (finished.load(std::memory_order_acquire) < pThreads)
+                    std::this_thread::yield();
+                Clock::time_point stop = Clock::now();
+                AllocationDelta delta = allocations.delta();
+                released.store(true, std::memory_order_release);
+                for (std::thread& worker : workers)
+                    worker.join();
+
+                if (idx < mOptions.warmup)
+                    continue;
+                result.samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+                threadSamples.insert(threadSamples.end(), elapsed.begin(), elapsed.end());
+                if (tracking)
+                    counts.push_back({static_cast<double>(delta.allocations),
+                                      static_cast<double>(delta.allocatedBytes),
+                                      static_cast<double>(delta.liveBytes),
+                                      static_cast<double>(delta.peakBytes)});
+            }
+
+            result.stats = summarize(result.samples);
+            std::size_t operations = std::max<std::size_t>(1, pSize);
+            result.counters.emplace_back("thread-ns", summarize(threadSamples).median / operations);
+            const char* names[] = {"allocs", "alloc-bytes", "live-bytes", "peak-bytes"};
+            for (std::size_t counter = 0; tracking && counter < 4; ++counter) {
+                std::vector<double> values;
+                for (auto& repetition : counts)
+                    values.push_back(repetition[counter]);
+                result.counters.emplace_back(names[counter], summarize(values).median / (operations * pThreads));
+            }
+            mResults.push_back(result);
+        }
+    };
+
+}
+}
+
+#endif // AISDI_LINEAR_BENCHMARK_H
@@ -0,0 +1,398 @@
+#ifndef AISDI_LINEAR_BENCHMARKSTORE_H
+#define AISDI_LINEAR_BENCHMARKSTORE_H
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+#include "Benchmark.h"
+
+#ifndef AISDI_BENCH_FLAGS
+#  define AISDI_BENCH_FLAGS "unknown"
+#endif
+#ifndef AISDI_GIT_COMMIT
+#  define AISDI_GIT_COMMIT "unknown"
+#endif
+
+namespace aisdi {
+namespace bench {
+
+    struct Metadata {
+        std::string host;
+        std::string compiler;
+        std::string flags;
+        std::string commit;
+        std::string timestamp;
+    };
+
+    inline Metadata collectMetadata() {
+        Metadata metadata;
+        char host[256] = {0};
+        if (gethostname(host, sizeof(host) - 1) == 0)
+            metadata.host = host;
+#if defined(__clang__)
+        metadata.compiler = std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+        metadata.compiler = std::string("gcc ") + __VERSION__;
+#else
+        metadata.compiler = "unknown";
+#endif
+        metadata.flags = AISDI_BENCH_FLAGS;
+        metadata.commit = AISDI_GIT_COMMIT;
+        char timestamp[32] = {0};
+        std::time_t now = std::time(nullptr);
+        std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+        metadata.timestamp = timestamp;
+        return metadata;
+    }
+
+    inline std::string quoted(const std::string& pText) {
+        std::string out = "\"";
+        for (char c : pText) {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            if (static_cast<unsigned char>(c) < 0x20)
+                continue;
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    // Timings are written in whole nanoseconds, one result per line; counters are per operation.
+    inline void writeJson(std::ostream& out, const Metadata& pMetadata, const std::vector<Result>& pResults) {
+        out << "{\n  \"metadata\": {"
+            << "\"host\": " << quoted(pMetadata.host)
+            << ", \"compiler\": " << quoted(pMetadata.compiler)
+            << ", \"flags\": " << quoted(pMetadata.flags)
+            << ", \"commit\": " << quoted(pMetadata.commit)
+            << ", \"timestamp\": " << quoted(pMetadata.timestamp) << "},\n"
+            << "  \"unit\": \"ns\",\n  \"results\": [";
+        out << std::fixed << std::setprecision(0);
+        for (std::size_t idx = 0; idx < pResults.size(); ++idx) {
+            const Result& result = pResults[idx];
+            out << (idx == 0 ? "\n" : ",\n")
+                << "    {\"benchmark\": " << quoted(result.benchmark)
+                << ", \"container\": " << quoted(result.container)
+                << ", \"type\": " << quoted(result.type)
+                << ", \"size\": " << result.size
+                << ", \"threads\": " << result.threads
+                << ", \"median\": " << result.stats.median
+                << ", \"p95\": " << result.stats.p95
+                << ", \"stddev\": " << result.stats.stddev
+                << ", \"mean\": " << result.stats.mean
+                << ", \"min\": " << result.stats.min
+                << ", \"samples\": [";
+            for (std::size_t sample = 0; sample < result.samples.size(); ++sample)
+                out << (sample == 0 ? "" : ", ") << result.samples[sample];
+            out << "]";
+            if (!result.counters.empty()) {
+                out << std::setprecision(4) << ", \"counters\": {";
+                for (std::size_t counter = 0; counter < result.counters.size(); ++counter)
+                    out << (counter == 0 ? "" : ", ") << quoted(result.counters[counter].first) << ": "
+                        << result.counters[counter].second;
+                out << "}" << std::setprecision(0);
+            }
+            out << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    struct JsonValue {
+        enum Kind {
+            Null, Bool, Number, String, Array, Object
+        };
+
+        Kind kind = Null;
+        bool boolean = false;
+        double number = 0;
+        std::string string;
+        std::vector<JsonValue> array;
+        std::vector<std::pair<std::string, JsonValue>> members;
+
+        bool has(const std::string& pKey) const {
+            for (auto& member : members)
+                if (member.first == pKey)
+                    return true;
+            return false;
+        }
+
+        // Throws std::runtime_error when the member is missing.
+        const JsonValue& operator[](const std::string& pKey) const {
+            for (auto& member : members)
+                if (member.first == pKey)
+                    return member.second;
+            throw std::runtime_error("Missing JSON member " + pKey);
+        }
+    };
+
+    /*
+     * Minimal reader for the files written by writeJson: no unicode escapes,
+     * throws std::runtime_error on malformed input.
+     */
+    class JsonParser {
+    public:
+        explicit JsonParser(const std::string& pText) : mText(pText), mPos(0) { }
+
+        JsonValue parse() {
+            JsonValue value = parseValue();
+            skipSpaces();
+            if (mPos != mText.size())
+                fail("trailing characters");
+            return value;
+        }
+
+    private:
+        const std::string& mText;
+        std::size_t mPos;
+
+        void fail(const std::string& pWhat) const {
+            throw std::runtime_error("Malformed JSON at offset " + std::to_string(mPos) + ": " + pWhat);
+        }
+
+        void skipSpaces() {
+            while (mPos < mText.size() && std::isspace(static_cast<unsigned char>(mText[mPos])))
+                ++mPos;
+        }
+
+        void expect(char c) {
+            skipSpaces();
+            if (mPos >= mText.size() || mText[mPos] != c)
+                fail(std::string("expected ") + c);
+            ++mPos;
+        }
+
+        bool consume(char c) {
+            skipSpaces();
+            if (mPos < mText.size() && mText[mPos] == c) {
+                ++mPos;
+                return true;
+            }
+            return false;
+        }
+
+        bool consumeWord(const char* pWord) {
+            std::string word(pWord);
+            if (mText.compare(mPos, word.size(), word) != 0)
+                return false;
+            mPos += word.size();
+            return true;
+        }
+
+        std::string parseString() {
+            expect('"');
+            std::string out;
+            while (mPos < mText.size() && mText[mPos] != '"') {
+                if (mText[mPos] == '\\' && mPos + 1 < mText.size())
+                    ++mPos;
+                out += mText[mPos++];
+            }
+            expect('"');
+            return out;
+        }
+
+        JsonValue parseValue() {
+            JsonValue value;
+            skipSpaces();
+            if (mPos >= mText.size())
+                fail("unexpected end");
+
+            char c = mText[mPos];
+            if (c == '{') {
+                value.kind = JsonValue::Object;
+                ++mPos;
+                if (consume('}'))
+                    return value;
+                do {
+                    std::string key = parseString();
+                    expect(':');
+                    value.members.emplace_back(key, parseValue());
+                } while (consume(','));
+                expect('}');
+            }
+            else if (c == '[') {
+                value.kind = JsonValue::Array;
+                ++mPos;
+                if (consume(']'))
+                    return value;
+                do {
+                    value.array.push_back(parseValue());
+                } while (consume(','));
+                expect(']');
+            }
+            else if (c == '"') {
+                value.kind = JsonValue::String;
+                value.string = parseString();
+            }
+            else if (consumeWord("true") || consumeWord("false")) {
+                value.kind = JsonValue::Bool;
+                value.boolean = c == 't';
+            }
+            else if (consumeWord("null")) {
+                value.kind = JsonValue::Null;
+            }
+            else {
+                const char* begin = mText.c_str() + mPos;
+                char* end = nullptr;
+                value.kind = JsonValue::Number;
+                value.number = std::strtod(begin, &end);
+                if (end == begin)
+                    fail("unexpected character");
+                mPos += end - begin;
+            }
+            return value;
+        }
+    };
+
+    inline std::vector<Result> readJson(std::istream& in) {
+        std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        JsonValue root = JsonParser(text).parse();
+
+        std::vector<Result> results;
+        for (const JsonValue& entry : root["results"].array) {
+            Result result;
+            result.benchmark = entry["benchmark"].string;
+            result.container = entry["container"].string;
+            // Files written before the element type matrix only measured int.
+            result.type = entry.has("type") ? entry["type"].string : "int";
+            result.size = static_cast<std::size_t>(entry["size"].number);
+            result.threads = entry.has("threads") ? static_cast<std::size_t>(entry["threads"].number) : 0;
+            for (const JsonValue& sample : entry["samples"].array)
+                result.samples.push_back(sample.number);
+            result.stats = summarize(result.samples);
+            results.push_back(result);
+        }
+        return results;
+    }
+
+    // Two-sided 95% (one-sided 97.5%) critical values of Student's t for 1..30 degrees of freedom.
+    inline double criticalT(double pDegrees) {
+        static const double table[] = {
+                12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+        };
+        std::size_t degrees = static_cast<std::size_t>(std::floor(pDegrees));
+        if (degrees < 1)
+            degrees = 1;
+        return degrees <= 30 ? table[degrees - 1] : 1.960;
+    }
+
+    inline bool isSameScenario(const Result& pLeft, const Result& pRight) {
+        return pLeft.benchmark == pRight.benchmark && pLeft.container == pRight.container
+               && pLeft.type == pRight.type && pLeft.size == pRight.size && pLeft.threads == pRight.threads;
+    }
+
+    struct Comparison {
+        Result baseline;
+        Result current;
+        double ratio;  // current median / baseline median
+        double t;      // Welch's t statistic, positive when current is slower
+        bool significant;
+        bool regression;
+        bool missing = false; // baseline result the current run did not produce
+    };
+
+    /*
+     * Pairs results by benchmark, container, type, size and thread count. A difference, either way, is
+     * significant when a two-sided Welch's t-test rejects equal means at 95%; it is a regression when it
+     * is significant, t is positive and the median slowed down by more than pThreshold (0.1 = 10%).
+     * Baseline results without a current counterpart are appended as missing.
+     */
+    inline std::vector<Comparison> compare(const std::vector<Result>& pBaseline, const std::vector<Result>& pCurrent,
+                                           double pThreshold) {
+        std::vector<Comparison> comparisons;
+        for (const Result& current : pCurrent) {
+            for (const Result& baseline : pBaseline) {
+                if (!isSameScenario(baseline, current))
+                    continue;
+
+                Comparison comparison;
+                comparison.baseline = baseline;
+                comparison.current = current;
+                comparison.ratio = baseline.stats.median > 0 ? current.stats.median / baseline.stats.median : 1;
+
+                double n1 = baseline.samples.size();
+                double n2 = current.samples.size();
+                double v1 = baseline.stats.stddev * baseline.stats.stddev / n1;
+                double v2 = current.stats.stddev * current.stats.stddev / n2;
+                double difference = current.stats.mean - baseline.stats.mean;
+                if (v1 + v2 > 0 && n1 > 1 && n2 > 1) {
+                    comparison.t = difference / std::sqrt(v1 + v2);
+                    double degrees = (v1 + v2) * (v1 + v2) / (v1 * v1 / (n1 - 1) + v2 * v2 / (n2 - 1));
+                    comparison.significant = std::fabs(comparison.t) > criticalT(degrees);
+                }
+                else {
+                    comparison.t = 0;
+                    comparison.significant = difference != 0;
+                }
+                comparison.regression = comparison.significant && comparison.t > 0
+                                        && comparison.ratio > 1 + pThreshold;
+                comparisons.push_back(comparison);
+                break;
+            }
+        }
+
+        for (const Result& baseline : pBaseline) {
+            if (std::any_of(pCurrent.begin(), pCurrent.end(), [&](const Result& pResult) {
+                return isSameScenario(baseline, pResult);
+            }))
+                continue;
+            Comparison comparison;
+            comparison.baseline = baseline;
+            comparison.ratio = 1;
+            comparison.t = 0;
+            comparison.significant = false;
+            comparison.regression = false;
+            comparison.missing = true;
+            comparisons.push_back(comparison);
+        }
+        return comparisons;
+    }
+
+    // Returns the number of regressions plus baseline results missing from the current run.
+    inline std::size_t reportComparison(std::ostream& out, const std::vector<Comparison>& pComparisons) {
+        std::size_t failures = 0;
+        out << std::left << std::setw(16) << "benchmark" << std::setw(18) << "container" << std::setw(16) << "type"
+            << std::right << std::setw(10) << "size" << std::setw(8) << "threads" << std::setw(16) << "baseline[ns]"
+            << std::setw(16) << "current[ns]" << std::setw(10) << "change" << std::setw(8) << "t" << "  verdict\n";
+        for (const Comparison& comparison : pComparisons) {
+            const char* verdict = "same";
+            if (comparison.missing)
+                verdict = "MISSING";
+            else if (comparison.regression)
+                verdict = "REGRESSION";
+            else if (comparison.significant)
+                verdict = comparison.t > 0 ? "slower" : "faster";
+            failures += comparison.regression || comparison.missing ? 1 : 0;
+
+            const Result& baseline = comparison.baseline;
+            out << std::left << std::setw(16) << baseline.benchmark
+                << std::setw(18) << baseline.container << std::setw(16) << baseline.type
+                << std::right << std::setw(10) << baseline.size << std::setw(8) << baseline.threads
+                << std::fixed << std::setprecision(0) << std::setw(16) << baseline.stats.median;
+            if (comparison.missing)
+                out << std::setw(16) << "-" << std::setw(10) << "-" << std::setw(8) << "-";
+            else
+                out << std::setw(16) << comparison.current.stats.median
+                    << std::showpos << std::setprecision(1) << std::setw(9) << (comparison.ratio - 1) * 100 << '%'
+                    << std::setprecision(2) << std::setw(8) << comparison.t << std::noshowpos;
+            out << "  " << verdict << '\n';
+        }
+        return failures;
+    }
+}
+}
+
+#endif // AISDI_LINEAR_BENCHMARKSTORE_H
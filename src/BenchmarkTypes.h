@@ -0,0 +1,159 @@
+#ifndef AISDI_LINEAR_BENCHMARKTYPES_H
+#define AISDI_LINEAR_BENCHMARKTYPES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aisdi {
+namespace bench {
+
+    /*
+     * Element types the benchmark scenarios are instantiated with. Element<T> names the type
+     * and builds the i-th value of a scenario.
+     */
+    template<std::size_t Bytes>
+    struct Pod {
+        std::int64_t words[Bytes / sizeof(std::int64_t)];
+    };
+
+    using Pod64 = Pod<64>;
+    using Pod256 = Pod<256>;
+
+    class MoveOnly {
+    public:
+        MoveOnly() = default;
+
+        explicit MoveOnly(std::int64_t pValue) : mValue(new std::int64_t(pValue)) { }
+
+        MoveOnly(MoveOnly&&) = default;
+
+        MoveOnly& operator=(MoveOnly&&) = default;
+
+        MoveOnly(const MoveOnly&) = delete;
+
+        MoveOnly& operator=(const MoveOnly&) = delete;
+
+    private:
+        std::unique_ptr<std::int64_t> mValue;
+    };
+
+    // Copies allocate and copy a 256-byte payload, moves only steal the pointer.
+    class ExpensiveCopy {
+    public:
+        ExpensiveCopy() = default;
+
+        explicit ExpensiveCopy(std::int64_t pValue) : mPayload(32, pValue) { }
+
+    private:
+        std::vector<std::int64_t> mPayload;
+    };
+
+    // Multi-field record whose scans usually read a single field.
+    struct Record {
+        std::int64_t id;
+        double price;
+        std::int32_t quantity;
+        std::int64_t timestamp;
+        char tag[16];
+    };
+
+    template<typename Type>
+    struct Element;
+
+    template<>
+    struct Element<bool> {
+        static const char* name() { return "bool"; }
+
+        static bool make(std::size_t i) { return i % 3 == 0; }
+    };
+
+    template<>
+    struct Element<int> {
+        static const char* name() { return "int"; }
+
+        static int make(std::size_t i) { return static_cast<int>(i); }
+    };
+
+    template<std::size_t Bytes>
+    struct Element<Pod<Bytes>> {
+        static const char* name() { return Bytes == 64 ? "pod64" : "pod256"; }
+
+        static Pod<Bytes> make(std::size_t i) {
+            Pod<Bytes> pod;
+            for (auto& word : pod.words)
+                word = static_cast<std::int64_t>(i);
+            return pod;
+        }
+    };
+
+    // Fits in the small string buffer of common standard libraries.
+    struct ShortString : public std::string {
+        ShortString() = default;
+
+        explicit ShortString(std::string pValue) : std::string(std::move(pValue)) { }
+    };
+
+    // Always heap allocated.
+    struct LongString : public std::string {
+        LongString() = default;
+
+        explicit LongString(std::string pValue) : std::string(std::move(pValue)) { }
+    };
+
+    template<>
+    struct Element<Record> {
+        static const char* name() { return "record"; }
+
+        static Record make(std::size_t i) {
+            Record record = Record();
+            record.id = static_cast<std::int64_t>(i);
+            record.price = static_cast<double>(i % 1000) / 4;
+            record.quantity = static_cast<std::int32_t>(i % 100);
+            record.timestamp = static_cast<std::int64_t>(i * 1000);
+            return record;
+        }
+    };
+
+    template<>
+    struct Element<std::string> {
+        static const char* name() { return "string"; }
+
+        static std::string make(std::size_t i) { return std::to_string(i); }
+    };
+
+    template<>
+    struct Element<ShortString> {
+        static const char* name() { return "string-short"; }
+
+        static ShortString make(std::size_t i) { return ShortString(std::to_string(i % 1000000)); }
+    };
+
+    template<>
+    struct Element<LongString> {
+        static const char* name() { return "string-long"; }
+
+        static LongString make(std::size_t i) { return LongString(std::string(64, 'x') + std::to_string(i)); }
+    };
+
+    template<>
+    struct Element<MoveOnly> {
+        static const char* name() { return "move-only"; }
+
+        static MoveOnly make(std::size_t i) { return MoveOnly(static_cast<std::int64_t>(i)); }
+    };
+
+    template<>
+    struct Element<ExpensiveCopy> {
+        static const char* name() { return "expensive-copy"; }
+
+        static ExpensiveCopy make(std::size_t i) { return ExpensiveCopy(static_cast<std::int64_t>(i)); }
+    };
+
+}
+}
+
+#endif // AISDI_LINEAR_BENCHMARKTYPES_H
@@ -0,0 +1,548 @@
+#ifndef AISDI_LINEAR_BITVECTOR_H
+#define AISDI_LINEAR_BITVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi {
+
+    namespace bits {
+
+        inline unsigned popcount(std::uint64_t pWord) {
+#if defined(__GNUC__)
+            return static_cast<unsigned>(__builtin_popcountll(pWord));
+#else
+            unsigned count = 0;
+            for (; pWord != 0; pWord &= pWord - 1)
+                ++count;
+            return count;
+#endif
+        }
+
+        // Index of the lowest set bit, pWord must not be zero.
+        inline unsigned countTrailingZeros(std::uint64_t pWord) {
+#if defined(__GNUC__)
+            return static_cast<unsigned>(__builtin_ctzll(pWord));
+#else
+            unsigned count = 0;
+            for (; (pWord & 1) == 0; pWord >>= 1)
+                ++count;
+            return count;
+#endif
+        }
+
+        // Mask of the pCount lowest bits, pCount <= 64.
+        inline std::uint64_t lowMask(std::size_t pCount) {
+            return pCount >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << pCount) - 1;
+        }
+
+    }
+
+    /*
+     * Sequence of bits packed 64 to a word, with the interface of Vector<bool> plus whole-word
+     * operations: appendBits, popcount, findFirstSet and bitwise &=, |=, ^=.
+     * Iterators dereference to bool, or to a Reference proxy for writing.
+     *
+     * Bits past getSize() are kept zero, so whole-word operations need no masking.
+     */
+    class BitVector {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = bool;
+        using Word = std::uint64_t;
+
+        class Reference;
+
+        class ConstIterator;
+
+        class Iterator;
+
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        static const std::size_t WORD_BITS = 64;
+
+        // Storage is allocated by the first insert, empty and moved-from vectors own no memory.
+        BitVector() noexcept : mCapacity(0), mCount(0), mWords(nullptr) { }
+
+        BitVector(std::initializer_list<bool> l) : BitVector() {
+            assign(l.begin(), l.end());
+        }
+
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        BitVector(InputIt first, InputIt last) : BitVector() {
+            assign(first, last);
+        }
+
+        BitVector(const BitVector& other) : BitVector() {
+            *this = other;
+        }
+
+        BitVector(BitVector&& other) noexcept : mCapacity(other.mCapacity), mCount(other.mCount),
+                                                mWords(other.mWords) {
+            other.mCapacity = 0;
+            other.mCount = 0;
+            other.mWords = nullptr;
+        }
+
+        ~BitVector() {
+            delete[] mWords;
+        }
+
+        BitVector& operator=(const BitVector& other) {
+            if (this == &other)
+                return *this;
+            std::size_t words = wordsFor(other.mCount);
+            if (words > mCapacity)
+                realocate(words);
+            std::copy(other.mWords, other.mWords + words, mWords);
+            for (std::size_t idx = words; idx < wordsFor(mCount); ++idx)
+                mWords[idx] = 0;
+            mCount = other.mCount;
+            return *this;
+        }
+
+        BitVector& operator=(BitVector&& other) noexcept {
+            if (this == &other)
+                return *this;
+            delete[] mWords;
+            mCapacity = other.mCapacity;
+            mCount = other.mCount;
+            mWords = other.mWords;
+            other.mCapacity = 0;
+            other.mCount = 0;
+            other.mWords = nullptr;
+            return *this;
+        }
+
+        // Replaces the contents with [first, last), which must not point into this vector.
+        template<typename InputIt>
+        void assign(InputIt first, InputIt last) {
+            clearBits(0);
+            for (; first != last; ++first)
+                append(static_cast<bool>(*first));
+        }
+
+        bool isEmpty() const {
+            return mCount == 0;
+        }
+
+        size_type getSize() const {
+            return mCount;
+        }
+
+        bool get(size_type pIdx) const {
+            if (pIdx >= mCount)
+                throw std::out_of_range("Bit index out of range");
+            return (mWords[pIdx / WORD_BITS] >> (pIdx % WORD_BITS)) & 1;
+        }
+
+        void set(size_type pIdx, bool pValue = true) {
+            if (pIdx >= mCount)
+                throw std::out_of_range("Bit index out of range");
+            Word mask = Word(1) << (pIdx % WORD_BITS);
+            if (pValue)
+                mWords[pIdx / WORD_BITS] |= mask;
+            else
+                mWords[pIdx / WORD_BITS] &= ~mask;
+        }
+
+        void append(bool item) {
+            reserveBits(mCount + 1);
+            ++mCount;
+            if (item)
+                mWords[(mCount - 1) / WORD_BITS] |= Word(1) << ((mCount - 1) % WORD_BITS);
+        }
+
+        // Appends the pCount lowest bits of pBits, lowest first, with at most two word writes.
+        void appendBits(Word pBits, std::size_t pCount = WORD_BITS) {
+            if (pCount > WORD_BITS)
+                throw std::invalid_argument("Can not append more than one word at once");
+            reserveBits(mCount + pCount);
+            writeBits(mCount, pCount, pBits & bits::lowMask(pCount));
+            mCount += pCount;
+        }
+
+        void prepend(bool item) {
+            insert_at(item, 0);
+        }
+
+        void insert(const const_iterator& insertPosition, bool item);
+
+        bool popFirst() {
+            if (mCount == 0) throw std::out_of_range("Can not popFirst, vector is empty");
+            bool item = get(0);
+            erase_range(0, 1);
+            return item;
+        }
+
+        bool popLast() {
+            if (mCount == 0) throw std::out_of_range("Can not popLast, vector is empty");
+            bool item = get(mCount - 1);
+            clearBits(mCount - 1);
+            return item;
+        }
+
+        void erase(const const_iterator& position);
+
+        void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded);
+
+        size_type popcount() const {
+            size_type count = 0;
+            for (std::size_t idx = 0; idx < wordsFor(mCount); ++idx)
+                count += bits::popcount(mWords[idx]);
+            return count;
+        }
+
+        // Index of the first set bit at or after pFrom, getSize() when there is none.
+        size_type findNextSet(size_type pFrom) const {
+            if (pFrom >= mCount)
+                return mCount;
+            std::size_t word = pFrom / WORD_BITS;
+            Word chunk = mWords[word] & ~bits::lowMask(pFrom % WORD_BITS);
+            const std::size_t words = wordsFor(mCount);
+            while (chunk == 0) {
+                if (++word == words)
+                    return mCount;
+                chunk = mWords[word];
+            }
+            return word * WORD_BITS + bits::countTrailingZeros(chunk);
+        }
+
+        size_type findFirstSet() const {
+            return findNextSet(0);
+        }
+
+        // Bitwise operations require vectors of equal size.
+        BitVector& operator&=(const BitVector& other) {
+            checkSameSize(other);
+            for (std::size_t idx = 0; idx < wordsFor(mCount); ++idx)
+                mWords[idx] &= other.mWords[idx];
+            return *this;
+        }
+
+        BitVector& operator|=(const BitVector& other) {
+            checkSameSize(other);
+            for (std::size_t idx = 0; idx < wordsFor(mCount); ++idx)
+                mWords[idx] |= other.mWords[idx];
+            return *this;
+        }
+
+        BitVector& operator^=(const BitVector& other) {
+            checkSameSize(other);
+            for (std::size_t idx = 0; idx < wordsFor(mCount); ++idx)
+                mWords[idx] ^= other.mWords[idx];
+            return *this;
+        }
+
+        iterator begin();
+
+        iterator end();
+
+        const_iterator cbegin() const;
+
+        const_iterator cend() const;
+
+        const_iterator begin() const;
+
+        const_iterator end() const;
+
+    private:
+        static const std::size_t INIT_CAPACITY = 4;
+        std::size_t mCapacity; // in words
+        std::size_t mCount;    // in bits
+        Word* mWords;
+
+        friend class ConstIterator;
+
+        static std::size_t wordsFor(std::size_t pBits) {
+            return (pBits + WORD_BITS - 1) / WORD_BITS;
+        }
+
+        void checkSameSize(const BitVector& pOther) const {
+            if (pOther.mCount != mCount)
+                throw std::invalid_argument("Bitwise operation on vectors of different size");
+        }
+
+        // New words are zeroed, keeping the invariant for bits past mCount.
+        void realocate(std::size_t pWords) {
+            Word* tmp = new Word[pWords]();
+            std::copy(mWords, mWords + wordsFor(mCount), tmp);
+            delete[] mWords;
+            mWords = tmp;
+            mCapacity = pWords;
+        }
+
+        void reserveBits(std::size_t pBits) {
+            std::size_t words = wordsFor(pBits);
+            if (words <= mCapacity)
+                return;
+            std::size_t capacity = mCapacity * 2;
+            if (capacity < INIT_CAPACITY)
+                capacity = INIT_CAPACITY;
+            if (capacity < words)
+                capacity = words;
+            realocate(capacity);
+        }
+
+        // Drops bits from pCount on, zeroing them.
+        void clearBits(std::size_t pCount) {
+            if (pCount >= mCount)
+                return;
+            std::size_t word = pCount / WORD_BITS;
+            if (word < mCapacity)
+                mWords[word] &= bits::lowMask(pCount % WORD_BITS);
+            std::fill(mWords + std::min(word + 1, mCapacity), mWords + wordsFor(mCount), Word(0));
+            mCount = pCount;
+        }
+
+        // Reads pCount <= 64 bits starting at bit pPosition.
+        Word readBits(std::size_t pPosition, std::size_t pCount) const {
+            std::size_t word = pPosition / WORD_BITS;
+            std::size_t offset = pPosition % WORD_BITS;
+            Word chunk = mWords[word] >> offset;
+            if (offset != 0 && offset + pCount > WORD_BITS)
+                chunk |= mWords[word + 1] << (WORD_BITS - offset);
+            return chunk & bits::lowMask(pCount);
+        }
+
+        // Overwrites pCount <= 64 bits starting at bit pPosition with the low bits of pBits.
+        void writeBits(std::size_t pPosition, std::size_t pCount, Word pBits) {
+            if (pCount == 0)
+                return;
+            std::size_t word = pPosition / WORD_BITS;
+            std::size_t offset = pPosition % WORD_BITS;
+            Word mask = bits::lowMask(pCount);
+            mWords[word] = (mWords[word] & ~(mask << offset)) | (pBits << offset);
+            if (offset != 0 && offset + pCount > WORD_BITS) {
+                std::size_t shift = WORD_BITS - offset;
+                mWords[word + 1] = (mWords[word + 1] & ~(mask >> shift)) | (pBits >> shift);
+            }
+        }
+
+        // Shifts the words above pPosition up by one bit, carrying between words.
+        void insert_at(bool pValue, std::size_t pPosition) {
+            if (pPosition > mCount)
+                throw std::out_of_range("Inserting out of range");
+            reserveBits(mCount + 1);
+            std::size_t first = pPosition / WORD_BITS;
+            for (std::size_t word = wordsFor(mCount + 1) - 1; word > first; --word)
+                mWords[word] = (mWords[word] << 1) | (mWords[word - 1] >> (WORD_BITS - 1));
+            Word low = bits::lowMask(pPosition % WORD_BITS);
+            mWords[first] = (mWords[first] & low) | ((mWords[first] & ~low) << 1);
+            if (pValue)
+                mWords[first] |= Word(1) << (pPosition % WORD_BITS);
+            ++mCount;
+        }
+
+        // Moves the bits after the range down a word at a time.
+        void erase_range(std::size_t pFirst, std::size_t pLast) {
+            if (pFirst >= pLast)
+                return;
+            std::size_t target = pFirst;
+            for (std::size_t source = pLast; source < mCount;) {
+                std::size_t count = mCount - source;
+                if (count > WORD_BITS)
+                    count = WORD_BITS;
+                writeBits(target, count, readBits(source, count));
+                target += count;
+                source += count;
+            }
+            clearBits(target);
+        }
+    };
+
+    // Writable proxy for one bit.
+    class BitVector::Reference {
+    public:
+        Reference(Word& pWord, Word pMask) : mWord(pWord), mMask(pMask) { }
+
+        Reference(const Reference&) = default;
+
+        operator bool() const {
+            return (mWord & mMask) != 0;
+        }
+
+        Reference& operator=(bool pValue) {
+            if (pValue)
+                mWord |= mMask;
+            else
+                mWord &= ~mMask;
+            return *this;
+        }
+
+        Reference& operator=(const Reference& other) {
+            return operator=(static_cast<bool>(other));
+        }
+
+    private:
+        Word& mWord;
+        Word mMask;
+    };
+
+    class BitVector::ConstIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = bool;
+        using difference_type = BitVector::difference_type;
+        using pointer = void;
+        using reference = bool;
+
+        friend class BitVector;
+
+        explicit ConstIterator(const BitVector& pVector, std::size_t pIdx) : mVector(pVector), mIndex(pIdx) { }
+
+        reference operator*() const {
+            if (mIndex == mVector.mCount)
+                throw std::out_of_range("Dereferencing end iterator");
+            return mVector.get(mIndex);
+        }
+
+        ConstIterator& operator++() {
+            if (mIndex == mVector.mCount)
+                throw std::out_of_range("Iterator out of range");
+            ++mIndex;
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator it(*this);
+            operator++();
+            return it;
+        }
+
+        ConstIterator& operator--() {
+            if (mIndex == 0)
+                throw std::out_of_range("Iterator out of range");
+            --mIndex;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            ConstIterator it(*this);
+            operator--();
+            return it;
+        }
+
+        ConstIterator operator+(difference_type d) const {
+            std::size_t new_idx = mIndex + d;
+            if (new_idx >= mVector.mCount)
+                return ConstIterator(mVector, mVector.mCount);
+            return ConstIterator(mVector, new_idx);
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            if (mIndex < (std::size_t) d)
+                throw std::out_of_range("Iterator out of range");
+            return ConstIterator(mVector, mIndex - d);
+        }
+
+        bool operator==(const ConstIterator& other) const {
+            return (mIndex == other.mIndex) && (&mVector == &other.mVector);
+        }
+
+        bool operator!=(const ConstIterator& other) const {
+            return !operator==(other);
+        }
+
+    protected:
+        const BitVector& mVector;
+        std::size_t mIndex;
+    };
+
+    class BitVector::Iterator : public BitVector::ConstIterator {
+    public:
+        using reference = BitVector::Reference;
+
+        explicit Iterator(const BitVector& pVector, std::size_t pIdx) : ConstIterator(pVector, pIdx) { }
+
+        Iterator(const ConstIterator& other) : ConstIterator(other) { }
+
+        Iterator& operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator& operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        reference operator*() const {
+            if (mIndex == mVector.mCount)
+                throw std::out_of_range("Dereferencing end iterator");
+            // ugly cast, yet reduces code duplication.
+            Word& word = const_cast<Word&>(mVector.mWords[mIndex / WORD_BITS]);
+            return Reference(word, Word(1) << (mIndex % WORD_BITS));
+        }
+    };
+
+    inline void BitVector::insert(const const_iterator& insertPosition, bool item) {
+        insert_at(item, insertPosition.mIndex);
+    }
+
+    inline void BitVector::erase(const const_iterator& position) {
+        if (position.mIndex >= mCount)
+            throw std::out_of_range("Erasing out of range");
+        erase_range(position.mIndex, position.mIndex + 1);
+    }
+
+    inline void BitVector::erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded) {
+        if (lastExcluded.mIndex > mCount)
+            throw std::out_of_range("Erasing end");
+        erase_range(firstIncluded.mIndex, lastExcluded.mIndex);
+    }
+
+    inline BitVector::iterator BitVector::begin() {
+        return Iterator(*this, 0);
+    }
+
+    inline BitVector::iterator BitVector::end() {
+        return Iterator(*this, mCount);
+    }
+
+    inline BitVector::const_iterator BitVector::cbegin() const {
+        return ConstIterator(*this, 0);
+    }
+
+    inline BitVector::const_iterator BitVector::cend() const {
+        return ConstIterator(*this, mCount);
+    }
+
+    inline BitVector::const_iterator BitVector::begin() const {
+        return cbegin();
+    }
+
+    inline BitVector::const_iterator BitVector::end() const {
+        return cend();
+    }
+
+}
+
+#endif // AISDI_LINEAR_BITVECTOR_H
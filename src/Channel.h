@@ -0,0 +1,189 @@
+#ifndef AISDI_LINEAR_CHANNEL_H
+#define AISDI_LINEAR_CHANNEL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include "LinkedList.h"
+
+namespace aisdi {
+
+    /*
+     * Bounded multi-producer, multi-consumer queue for handing items between threads. Items wait in
+     * a LinkedList guarded by a mutex; senders block while it holds getCapacity() items and receivers
+     * block while it is empty, sleeping on condition variables instead of polling.
+     *
+     * close() ends the stream: further sends fail, receivers get the remaining items and then fail.
+     * sendMany() and receiveMany() move whole batches under one lock and one wake-up.
+     */
+    template<typename Type>
+    class Channel {
+    public:
+        using size_type = std::size_t;
+        using value_type = Type;
+
+        explicit Channel(size_type pCapacity)
+                : mMutex(), mNotFull(), mNotEmpty(), mItems(), mCapacity(pCapacity), mClosed(false),
+                  mWaitingSenders(0), mWaitingReceivers(0) {
+            if (pCapacity == 0)
+                throw std::invalid_argument("Channel capacity must be positive");
+        }
+
+        Channel(const Channel&) = delete;
+        Channel& operator=(const Channel&) = delete;
+
+        size_type getCapacity() const {
+            return mCapacity;
+        }
+
+        size_type getSize() const {
+            std::lock_guard<std::mutex> lock(mMutex);
+            return mItems.getSize();
+        }
+
+        bool isClosed() const {
+            std::lock_guard<std::mutex> lock(mMutex);
+            return mClosed;
+        }
+
+        // Wakes all waiting senders and receivers. Closing twice does nothing.
+        void close() {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mClosed = true;
+            mNotFull.notify_all();
+            mNotEmpty.notify_all();
+        }
+
+        // Blocks while the channel is full. Returns false, leaving pItem untouched, once the channel is closed.
+        bool send(const Type& pItem) {
+            return send_item(pItem);
+        }
+
+        bool send(Type&& pItem) {
+            return send_item(std::move(pItem));
+        }
+
+        // Returns false, leaving pItem untouched, when the channel is full or closed.
+        bool trySend(const Type& pItem) {
+            return try_send_item(pItem);
+        }
+
+        bool trySend(Type&& pItem) {
+            return try_send_item(std::move(pItem));
+        }
+
+        // Blocks while the channel is empty and open. Returns false once it is closed and drained.
+        bool receive(Type& pItem) {
+            std::unique_lock<std::mutex> lock(mMutex);
+            wait_for_items(lock);
+            if (mItems.isEmpty())
+                return false;
+            pItem = mItems.popFirst();
+            wake(mNotFull, mWaitingSenders, false);
+            return true;
+        }
+
+        // Returns false when the channel is empty.
+        bool tryReceive(Type& pItem) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mItems.isEmpty())
+                return false;
+            pItem = mItems.popFirst();
+            wake(mNotFull, mWaitingSenders, false);
+            return true;
+        }
+
+        /*
+         * Sends [first, last), blocking whenever the channel is full. Returns the position of the first item
+         * which was not sent, last unless the channel got closed.
+         */
+        template<typename InputIt>
+        InputIt sendMany(InputIt first, InputIt last) {
+            std::unique_lock<std::mutex> lock(mMutex);
+            while (first != last) {
+                ++mWaitingSenders;
+                mNotFull.wait(lock, [this] { return mClosed || mItems.getSize() < mCapacity; });
+                --mWaitingSenders;
+                if (mClosed)
+                    break;
+                size_type sent = 0;
+                for (; first != last && mItems.getSize() < mCapacity; ++first, ++sent)
+                    mItems.append(*first);
+                wake(mNotEmpty, mWaitingReceivers, sent > 1);
+            }
+            return first;
+        }
+
+        /*
+         * Blocks until the channel has items or is closed, then takes up to pMaxCount of them. Returns
+         * how many items were written to pOut, 0 only once the channel is closed and drained.
+         */
+        template<typename OutputIt>
+        size_type receiveMany(OutputIt pOut, size_type pMaxCount) {
+            std::unique_lock<std::mutex> lock(mMutex);
+            if (pMaxCount == 0)
+                return 0;
+            wait_for_items(lock);
+            size_type received = 0;
+            for (; received < pMaxCount && !mItems.isEmpty(); ++received) {
+                *pOut = mItems.popFirst();
+                ++pOut;
+            }
+            wake(mNotFull, mWaitingSenders, received > 1);
+            return received;
+        }
+
+    private:
+        mutable std::mutex mMutex;
+        std::condition_variable mNotFull;
+        std::condition_variable mNotEmpty;
+        LinkedList<Type> mItems;
+        size_type mCapacity;
+        bool mClosed;
+        size_type mWaitingSenders;      // waiter counts let the uncontended path skip notifying
+        size_type mWaitingReceivers;
+
+        static void wake(std::condition_variable& pCondition, size_type pWaiting, bool pAll) {
+            if (pWaiting == 0)
+                return;
+            if (pAll)
+                pCondition.notify_all();
+            else
+                pCondition.notify_one();
+        }
+
+        void wait_for_items(std::unique_lock<std::mutex>& pLock) {
+            ++mWaitingReceivers;
+            mNotEmpty.wait(pLock, [this] { return mClosed || !mItems.isEmpty(); });
+            --mWaitingReceivers;
+        }
+
+        template<typename Item>
+        bool send_item(Item&& pItem) {
+            std::unique_lock<std::mutex> lock(mMutex);
+            ++mWaitingSenders;
+            mNotFull.wait(lock, [this] { return mClosed || mItems.getSize() < mCapacity; });
+            --mWaitingSenders;
+            if (mClosed)
+                return false;
+            mItems.append(std::forward<Item>(pItem));
+            wake(mNotEmpty, mWaitingReceivers, false);
+            return true;
+        }
+
+        template<typename Item>
+        bool try_send_item(Item&& pItem) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mClosed || mItems.getSize() >= mCapacity)
+                return false;
+            mItems.append(std::forward<Item>(pItem));
+            wake(mNotEmpty, mWaitingReceivers, false);
+            return true;
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_CHANNEL_H
@@ -0,0 +1,444 @@
+#ifndef AISDI_LINEAR_COMPRESSEDINTVECTOR_H
+#define AISDI_LINEAR_COMPRESSEDINTVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi {
+
+    /*
+     * Append-only vector of integers compressed in blocks of BLOCK_SIZE values. Every full block
+     * is bit-packed at the smallest width that fits either
+     *   - frame of reference: value - minimum of the block, or
+     *   - delta: difference to the previous value, minus the smallest difference in the block,
+     * whichever is narrower. Sorted ids and timestamps take the delta form.
+     *
+     * Appended values wait uncompressed until their block fills up. get() finds the block in O(1)
+     * and decodes one value for frame of reference blocks, up to BLOCK_SIZE values for delta ones;
+     * iterators and decodeBlock() decode sequentially at O(1) per value.
+     */
+    template<typename Type>
+    class CompressedIntVector {
+        static_assert(std::is_integral<Type>::value, "CompressedIntVector stores integers only");
+
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using reference = Type;
+        using const_reference = Type;
+
+        class ConstIterator;
+
+        friend class ConstIterator;
+
+        // Values can not be changed in place, both iterators are read-only.
+        using iterator = ConstIterator;
+        using const_iterator = ConstIterator;
+
+        static const std::size_t BLOCK_SIZE = 128;
+
+        // Storage is allocated by the first append, empty and moved-from vectors own no memory.
+        CompressedIntVector() noexcept : mBlocks(nullptr), mBlockCount(0), mBlockCapacity(0), mWords(nullptr),
+                                         mWordCount(0), mWordCapacity(0), mTail(nullptr), mTailCount(0) { }
+
+        CompressedIntVector(std::initializer_list<Type> l) : CompressedIntVector() {
+            for (Type value : l)
+                append(value);
+        }
+
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        CompressedIntVector(InputIt first, InputIt last) : CompressedIntVector() {
+            for (; first != last; ++first)
+                append(*first);
+        }
+
+        CompressedIntVector(const CompressedIntVector& other) : CompressedIntVector() {
+            mBlocks = copyOf(other.mBlocks, other.mBlockCount);
+            mBlockCount = mBlockCapacity = other.mBlockCount;
+            mWords = copyOf(other.mWords, other.mWordCount);
+            mWordCount = mWordCapacity = other.mWordCount;
+            if (other.mTail != nullptr) {
+                mTail = new Type[BLOCK_SIZE];
+                std::copy(other.mTail, other.mTail + other.mTailCount, mTail);
+            }
+            mTailCount = other.mTailCount;
+        }
+
+        CompressedIntVector(CompressedIntVector&& other) noexcept : CompressedIntVector() {
+            swap(other);
+        }
+
+        ~CompressedIntVector() {
+            delete[] mBlocks;
+            delete[] mWords;
+            delete[] mTail;
+        }
+
+        CompressedIntVector& operator=(const CompressedIntVector& other) {
+            if (this != &other) {
+                CompressedIntVector copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        CompressedIntVector& operator=(CompressedIntVector&& other) noexcept {
+            if (this != &other) {
+                CompressedIntVector moved(std::move(other));
+                swap(moved);
+            }
+            return *this;
+        }
+
+        void swap(CompressedIntVector& other) noexcept {
+            std::swap(mBlocks, other.mBlocks);
+            std::swap(mBlockCount, other.mBlockCount);
+            std::swap(mBlockCapacity, other.mBlockCapacity);
+            std::swap(mWords, other.mWords);
+            std::swap(mWordCount, other.mWordCount);
+            std::swap(mWordCapacity, other.mWordCapacity);
+            std::swap(mTail, other.mTail);
+            std::swap(mTailCount, other.mTailCount);
+        }
+
+        bool isEmpty() const {
+            return getSize() == 0;
+        }
+
+        size_type getSize() const {
+            return mBlockCount * BLOCK_SIZE + mTailCount;
+        }
+
+        void append(Type item) {
+            if (mTail == nullptr)
+                mTail = new Type[BLOCK_SIZE];
+            mTail[mTailCount++] = item;
+            if (mTailCount == BLOCK_SIZE) {
+                encode(mTail);
+                mTailCount = 0;
+            }
+        }
+
+        Type get(size_type pIdx) const {
+            if (pIdx >= getSize())
+                throw std::out_of_range("Index out of range");
+            std::size_t block = pIdx / BLOCK_SIZE;
+            if (block == mBlockCount)
+                return mTail[pIdx % BLOCK_SIZE];
+            const Block& header = mBlocks[block];
+            const Word* words = mWords + header.offset;
+            std::size_t position = pIdx % BLOCK_SIZE;
+            if (!header.delta)
+                return static_cast<Type>(header.reference + unpack(words, position, header.width));
+            Unsigned value = header.reference + position * header.minDelta;
+            for (std::size_t idx = 1; idx <= position; ++idx)
+                value += unpack(words, idx, header.width);
+            return static_cast<Type>(value);
+        }
+
+        // Full blocks plus the partially filled one, if any.
+        size_type getBlockCount() const {
+            return mBlockCount + (mTailCount > 0 ? 1 : 0);
+        }
+
+        /*
+         * Writes the values of block pBlock to pOut, which must have room for BLOCK_SIZE values,
+         * and returns how many were written. The loops have fixed trip counts so the compiler
+         * can vectorize them.
+         */
+        size_type decodeBlock(size_type pBlock, Type* pOut) const {
+            if (pBlock >= getBlockCount())
+                throw std::out_of_range("Block out of range");
+            if (pBlock == mBlockCount) {
+                std::copy(mTail, mTail + mTailCount, pOut);
+                return mTailCount;
+            }
+            const Block& header = mBlocks[pBlock];
+            const Word* words = mWords + header.offset;
+            Unsigned values[BLOCK_SIZE];
+            unpackBlock(words, header.width, values, std::make_index_sequence<sizeof(Unsigned) * 8 + 1>());
+            if (header.delta) {
+                Unsigned value = header.reference;
+                pOut[0] = static_cast<Type>(value);
+                for (std::size_t idx = 1; idx < BLOCK_SIZE; ++idx) {
+                    value += values[idx] + header.minDelta;
+                    pOut[idx] = static_cast<Type>(value);
+                }
+            }
+            else {
+                for (std::size_t idx = 0; idx < BLOCK_SIZE; ++idx)
+                    pOut[idx] = static_cast<Type>(header.reference + values[idx]);
+            }
+            return BLOCK_SIZE;
+        }
+
+        // Bytes held by the compressed blocks, their headers and the uncompressed tail.
+        size_type getMemoryUsage() const {
+            return mBlockCapacity * sizeof(Block) + mWordCapacity * sizeof(Word)
+                   + (mTail != nullptr ? BLOCK_SIZE * sizeof(Type) : 0);
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+        const_iterator cbegin() const {
+            return ConstIterator(*this, 0);
+        }
+
+        const_iterator cend() const {
+            return ConstIterator(*this, getSize());
+        }
+
+    private:
+        using Unsigned = typename std::make_unsigned<Type>::type;
+        using Word = std::uint64_t;
+
+        static const std::size_t WORD_BITS = 64;
+
+        struct Block {
+            Unsigned reference;  // minimum for frame of reference, first value for delta
+            Unsigned minDelta;
+            std::size_t offset;  // first word in mWords, a block takes 2 * width words
+            std::uint8_t width;
+            bool delta;
+        };
+
+        Block* mBlocks;
+        std::size_t mBlockCount;
+        std::size_t mBlockCapacity;
+        Word* mWords;
+        std::size_t mWordCount;
+        std::size_t mWordCapacity;
+        Type* mTail;              // values of the block being filled
+        std::size_t mTailCount;
+
+        template<typename Element>
+        static Element* copyOf(const Element* pSource, std::size_t pCount) {
+            if (pCount == 0)
+                return nullptr;
+            Element* copy = new Element[pCount];
+            std::copy(pSource, pSource + pCount, copy);
+            return copy;
+        }
+
+        // Doubles pCapacity until it holds pRequired, moving the pCount used elements; new ones are zeroed.
+        template<typename Element>
+        static void grow(Element*& pData, std::size_t pCount, std::size_t& pCapacity, std::size_t pRequired) {
+            if (pRequired <= pCapacity)
+                return;
+            std::size_t capacity = pCapacity * 2;
+            if (capacity < pRequired)
+                capacity = pRequired;
+            Element* tmp = new Element[capacity]();
+            std::copy(pData, pData + pCount, tmp);
+            delete[] pData;
+            pData = tmp;
+            pCapacity = capacity;
+        }
+
+        static std::uint8_t bitWidth(Unsigned pValue) {
+            std::uint8_t width = 0;
+            for (; pValue != 0; pValue >>= 1)
+                ++width;
+            return width;
+        }
+
+        static Unsigned unpack(const Word* pWords, std::size_t pIdx, std::size_t pWidth) {
+            if (pWidth == 0)
+                return 0;
+            std::size_t bit = pIdx * pWidth;
+            std::size_t word = bit / WORD_BITS;
+            std::size_t offset = bit % WORD_BITS;
+            Word chunk = pWords[word] >> offset;
+            if (offset + pWidth > WORD_BITS)
+                chunk |= pWords[word + 1] << (WORD_BITS - offset);
+            if (pWidth < WORD_BITS)
+                chunk &= (Word(1) << pWidth) - 1;
+            return static_cast<Unsigned>(chunk);
+        }
+
+        template<std::size_t Width>
+        static void unpackBlock(const Word* pWords, Unsigned* pOut) {
+            for (std::size_t idx = 0; idx < BLOCK_SIZE; ++idx)
+                pOut[idx] = unpack(pWords, idx, Width);
+        }
+
+        // Dispatches to a loop compiled for the block's width, whose shifts and masks are constants.
+        template<std::size_t... Width>
+        static void unpackBlock(const Word* pWords, std::size_t pWidth, Unsigned* pOut,
+                                std::index_sequence<Width...>) {
+            using Unpacker = void (*)(const Word*, Unsigned*);
+            static const Unpacker unpackers[] = {&CompressedIntVector::unpackBlock<Width>...};
+            unpackers[pWidth](pWords, pOut);
+        }
+
+        // Words are zeroed when allocated and never reused, so packing only sets bits.
+        static void pack(Word* pWords, std::size_t pIdx, std::size_t pWidth, Unsigned pValue) {
+            if (pWidth == 0)
+                return;
+            Word value = static_cast<Word>(pValue);
+            std::size_t bit = pIdx * pWidth;
+            std::size_t word = bit / WORD_BITS;
+            std::size_t offset = bit % WORD_BITS;
+            pWords[word] |= value << offset;
+            if (offset + pWidth > WORD_BITS)
+                pWords[word + 1] |= value >> (WORD_BITS - offset);
+        }
+
+        void encode(const Type* pValues) {
+            Unsigned values[BLOCK_SIZE];
+            Unsigned deltas[BLOCK_SIZE];
+            for (std::size_t idx = 0; idx < BLOCK_SIZE; ++idx)
+                values[idx] = static_cast<Unsigned>(pValues[idx]);
+
+            Block header;
+            Unsigned minimum = *std::min_element(pValues, pValues + BLOCK_SIZE);
+            Unsigned maximum = *std::max_element(pValues, pValues + BLOCK_SIZE);
+            std::uint8_t referenceWidth = bitWidth(static_cast<Unsigned>(maximum - minimum));
+
+            deltas[0] = 0;
+            for (std::size_t idx = 1; idx < BLOCK_SIZE; ++idx)
+                deltas[idx] = static_cast<Unsigned>(values[idx] - values[idx - 1]);
+            Unsigned minDelta = *std::min_element(deltas + 1, deltas + BLOCK_SIZE);
+            Unsigned maxDelta = *std::max_element(deltas + 1, deltas + BLOCK_SIZE);
+            std::uint8_t deltaWidth = bitWidth(static_cast<Unsigned>(maxDelta - minDelta));
+
+            header.delta = deltaWidth < referenceWidth;
+            if (header.delta) {
+                header.reference = values[0];
+                header.minDelta = minDelta;
+                header.width = deltaWidth;
+                deltas[0] = minDelta;
+                for (std::size_t idx = 0; idx < BLOCK_SIZE; ++idx)
+                    values[idx] = deltas[idx] - minDelta;
+            }
+            else {
+                header.reference = minimum;
+                header.minDelta = 0;
+                header.width = referenceWidth;
+                for (std::size_t idx = 0; idx < BLOCK_SIZE; ++idx)
+                    values[idx] -= minimum;
+            }
+
+            std::size_t words = BLOCK_SIZE * header.width / WORD_BITS;
+            grow(mWords, mWordCount, mWordCapacity, mWordCount + words);
+            grow(mBlocks, mBlockCount, mBlockCapacity, mBlockCount + 1);
+            header.offset = mWordCount;
+            for (std::size_t idx = 0; idx < BLOCK_SIZE; ++idx)
+                pack(mWords + header.offset, idx, header.width, values[idx]);
+            mWordCount += words;
+            mBlocks[mBlockCount++] = header;
+        }
+
+        // Value at pIdx given the value at pIdx - 1, O(1) for every encoding.
+        Type next(std::size_t pIdx, Type pPrevious) const {
+            std::size_t block = pIdx / BLOCK_SIZE;
+            std::size_t position = pIdx % BLOCK_SIZE;
+            if (block == mBlockCount)
+                return mTail[position];
+            const Block& header = mBlocks[block];
+            if (header.delta && position == 0)
+                return static_cast<Type>(header.reference);
+            Unsigned packed = unpack(mWords + header.offset, position, header.width);
+            if (header.delta)
+                return static_cast<Type>(static_cast<Unsigned>(pPrevious) + packed + header.minDelta);
+            return static_cast<Type>(header.reference + packed);
+        }
+    };
+
+    template<typename Type>
+    const std::size_t CompressedIntVector<Type>::BLOCK_SIZE;
+
+    template<typename Type>
+    const std::size_t CompressedIntVector<Type>::WORD_BITS;
+
+    template<typename Type>
+    class CompressedIntVector<Type>::ConstIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename CompressedIntVector::value_type;
+        using difference_type = typename CompressedIntVector::difference_type;
+        using pointer = void;
+        using reference = Type;
+
+        // Keeps the current value, so stepping through delta blocks needs no prefix sums.
+        explicit ConstIterator(const CompressedIntVector& pVector, std::size_t pIdx)
+                : mVector(pVector), mIndex(pIdx), mValue(pIdx < pVector.getSize() ? pVector.get(pIdx) : Type()) { }
+
+        reference operator*() const {
+            if (mIndex == mVector.getSize())
+                throw std::out_of_range("Dereferencing end iterator");
+            return mValue;
+        }
+
+        ConstIterator& operator++() {
+            if (mIndex == mVector.getSize())
+                throw std::out_of_range("Iterator out of range");
+            ++mIndex;
+            if (mIndex < mVector.getSize())
+                mValue = mVector.next(mIndex, mValue);
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator it(*this);
+            operator++();
+            return it;
+        }
+
+        ConstIterator& operator--() {
+            if (mIndex == 0)
+                throw std::out_of_range("Iterator out of range");
+            --mIndex;
+            mValue = mVector.get(mIndex);
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            ConstIterator it(*this);
+            operator--();
+            return it;
+        }
+
+        ConstIterator operator+(difference_type d) const {
+            std::size_t new_idx = mIndex + d;
+            if (new_idx >= mVector.getSize())
+                return ConstIterator(mVector, mVector.getSize());
+            return ConstIterator(mVector, new_idx);
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            if (mIndex < (std::size_t) d)
+                throw std::out_of_range("Iterator out of range");
+            return ConstIterator(mVector, mIndex - d);
+        }
+
+        bool operator==(const ConstIterator& other) const {
+            return (mIndex == other.mIndex) && (&mVector == &other.mVector);
+        }
+
+        bool operator!=(const ConstIterator& other) const {
+            return !operator==(other);
+        }
+
+    private:
+        const CompressedIntVector& mVector;
+        std::size_t mIndex;
+        Type mValue;
+    };
+
+}
+
+#endif // AISDI_LINEAR_COMPRESSEDINTVECTOR_H
@@ -0,0 +1,132 @@
+#ifndef AISDI_LINEAR_CONTAINERSTATS_H
+#define AISDI_LINEAR_CONTAINERSTATS_H
+
+#include <cstddef>
+#include <string>
+
+/*
+ * Per-instance operation counters for Vector and LinkedList, compiled in with -DAISDI_LINEAR_STATS=1.
+ * When off, the mixin is an empty base and every counting call is an empty inline function.
+ * All translation units of a program must agree on the setting.
+ */
+#ifndef AISDI_LINEAR_STATS
+#  define AISDI_LINEAR_STATS 0
+#endif
+
+namespace aisdi {
+
+    struct OperationStats {
+        std::size_t appends = 0;
+        std::size_t prepends = 0;
+        std::size_t middleInserts = 0;
+        std::size_t erases = 0;
+        std::size_t elementsShifted = 0;
+        std::size_t realocations = 0;
+        std::size_t bytesCopied = 0;
+        std::size_t iteratorSteps = 0;
+    };
+
+    inline std::string toJson(const OperationStats& pStats) {
+        return "{\"appends\": " + std::to_string(pStats.appends)
+               + ", \"prepends\": " + std::to_string(pStats.prepends)
+               + ", \"middleInserts\": " + std::to_string(pStats.middleInserts)
+               + ", \"erases\": " + std::to_string(pStats.erases)
+               + ", \"elementsShifted\": " + std::to_string(pStats.elementsShifted)
+               + ", \"realocations\": " + std::to_string(pStats.realocations)
+               + ", \"bytesCopied\": " + std::to_string(pStats.bytesCopied)
+               + ", \"iteratorSteps\": " + std::to_string(pStats.iteratorSteps) + "}";
+    }
+
+    template<bool Enabled>
+    class StatsMixin;
+
+    template<>
+    class StatsMixin<true> {
+    public:
+        const OperationStats& stats() const {
+            return mStats;
+        }
+
+        std::string statsJson() const {
+            return toJson(mStats);
+        }
+
+        void resetStats() {
+            mStats = OperationStats();
+        }
+
+    protected:
+        void countAppend() const {
+            ++mStats.appends;
+        }
+
+        void countPrepend() const {
+            ++mStats.prepends;
+        }
+
+        void countMiddleInsert() const {
+            ++mStats.middleInserts;
+        }
+
+        void countErase(std::size_t pErased) const {
+            mStats.erases += pErased;
+        }
+
+        void countShift(std::size_t pElements) const {
+            mStats.elementsShifted += pElements;
+        }
+
+        void countRealocation(std::size_t pBytesCopied) const {
+            ++mStats.realocations;
+            mStats.bytesCopied += pBytesCopied;
+        }
+
+        void countCopy(std::size_t pBytes) const {
+            mStats.bytesCopied += pBytes;
+        }
+
+        void countSteps(std::size_t pSteps) const {
+            mStats.iteratorSteps += pSteps;
+        }
+
+    private:
+        // Counting happens through const iterators as well.
+        mutable OperationStats mStats;
+    };
+
+    template<>
+    class StatsMixin<false> {
+    public:
+        OperationStats stats() const {
+            return OperationStats();
+        }
+
+        std::string statsJson() const {
+            return toJson(OperationStats());
+        }
+
+        void resetStats() { }
+
+    protected:
+        void countAppend() const { }
+
+        void countPrepend() const { }
+
+        void countMiddleInsert() const { }
+
+        void countErase(std::size_t) const { }
+
+        void countShift(std::size_t) const { }
+
+        void countRealocation(std::size_t) const { }
+
+        void countCopy(std::size_t) const { }
+
+        void countSteps(std::size_t) const { }
+    };
+
+    using ContainerStats = StatsMixin<AISDI_LINEAR_STATS != 0>;
+
+}
+
+#endif // AISDI_LINEAR_CONTAINERSTATS_H
@@ -0,0 +1,250 @@
+#ifndef AISDI_LINEAR_FLATMAP_H
+#define AISDI_LINEAR_FLATMAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "SoAVector.h"
+#include "Vector.h"
+
+namespace aisdi {
+
+    /*
+     * Map with unique keys kept sorted in a SoAVector<Key, Value>: keys and values live in
+     * separate arrays, so binary search touches keys only. Like FlatSet, single inserts and erases
+     * are O(n) and insertBatch() merges k entries in O(n + k log k).
+     *
+     * Iterators are the SoAVector ones and dereference to std::tuple<const Key&, const Value&> proxies
+     * for const access and std::tuple<Key&, Value&> otherwise; changing a key through them breaks
+     * the ordering and is not allowed.
+     */
+    template<typename Key, typename Value, typename Compare = std::less<Key>>
+    class FlatMap {
+        using Entries = SoAVector<Key, Value>;
+
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = typename Entries::value_type;
+        using key_compare = Compare;
+        using reference = typename Entries::reference;
+        using const_reference = typename Entries::const_reference;
+
+        using iterator = typename Entries::iterator;
+        using const_iterator = typename Entries::const_iterator;
+
+        FlatMap() noexcept(std::is_nothrow_default_constructible<Compare>::value) : mEntries(), mCompare() { }
+
+        explicit FlatMap(const Compare& pCompare) : mEntries(), mCompare(pCompare) { }
+
+        FlatMap(std::initializer_list<value_type> l) : FlatMap() {
+            insertBatch(l.begin(), l.end());
+        }
+
+        // Accepts ranges of std::pair or std::tuple of a key and a value.
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        FlatMap(InputIt first, InputIt last) : FlatMap() {
+            insertBatch(first, last);
+        }
+
+        bool isEmpty() const {
+            return mEntries.isEmpty();
+        }
+
+        size_type getSize() const {
+            return mEntries.getSize();
+        }
+
+        // Returns false and keeps the present value when the key is already mapped.
+        bool insert(const Key& pKey, const Value& pValue) {
+            std::size_t idx = lower_bound_index(pKey);
+            if (matches(idx, pKey))
+                return false;
+            mEntries.insert(mEntries.cbegin() + idx, value_type(pKey, pValue));
+            return true;
+        }
+
+        bool insert(Key&& pKey, Value&& pValue) {
+            std::size_t idx = lower_bound_index(pKey);
+            if (matches(idx, pKey))
+                return false;
+            mEntries.insert(mEntries.cbegin() + idx, value_type(std::move(pKey), std::move(pValue)));
+            return true;
+        }
+
+        /*
+         * Inserts the entries of [first, last), pairs or tuples, whose keys are not mapped yet and
+         * returns how many were added. Within the batch the first entry of a key wins.
+         */
+        template<typename InputIt>
+        size_type insertBatch(InputIt first, InputIt last) {
+            Vector<value_type> batch;
+            for (; first != last; ++first)
+                batch.append(value_type(std::get<0>(*first), std::get<1>(*first)));
+            value_type* begin = batch.data();
+            value_type* end = begin + batch.getSize();
+            std::stable_sort(begin, end, [this](const value_type& pLeft, const value_type& pRight) {
+                return mCompare(std::get<0>(pLeft), std::get<0>(pRight));
+            });
+            end = std::unique(begin, end, [this](const value_type& pLeft, const value_type& pRight) {
+                return !mCompare(std::get<0>(pLeft), std::get<0>(pRight));
+            });
+            return merge(begin, end);
+        }
+
+        // Value of pKey, default-constructed and inserted first when the key is not mapped.
+        Value& operator[](const Key& pKey) {
+            std::size_t idx = lower_bound_index(pKey);
+            if (!matches(idx, pKey))
+                mEntries.insert(mEntries.cbegin() + idx, value_type(pKey, Value()));
+            return mEntries.template column<1>()[idx];
+        }
+
+        Value& at(const Key& pKey) {
+            return mEntries.template column<1>()[checked_index(pKey)];
+        }
+
+        const Value& at(const Key& pKey) const {
+            return mEntries.template column<1>()[checked_index(pKey)];
+        }
+
+        // Returns whether an entry was erased.
+        bool erase(const Key& pKey) {
+            std::size_t idx = find_index(pKey);
+            if (idx == getSize())
+                return false;
+            mEntries.erase(mEntries.cbegin() + idx);
+            return true;
+        }
+
+        void erase(const const_iterator& position) {
+            mEntries.erase(position);
+        }
+
+        // First entry whose key is not ordered before pKey.
+        iterator lower_bound(const Key& pKey) {
+            return mEntries.begin() + lower_bound_index(pKey);
+        }
+
+        const_iterator lower_bound(const Key& pKey) const {
+            return mEntries.cbegin() + lower_bound_index(pKey);
+        }
+
+        iterator find(const Key& pKey) {
+            return mEntries.begin() + find_index(pKey);
+        }
+
+        const_iterator find(const Key& pKey) const {
+            return mEntries.cbegin() + find_index(pKey);
+        }
+
+        bool contains(const Key& pKey) const {
+            return find_index(pKey) != getSize();
+        }
+
+        // Keys in ascending order and the values in the same order, valid until the next insert or erase.
+        ColumnSpan<const Key> keys() const {
+            return mEntries.template column<0>();
+        }
+
+        ColumnSpan<Value> values() {
+            return mEntries.template column<1>();
+        }
+
+        ColumnSpan<const Value> values() const {
+            return mEntries.template column<1>();
+        }
+
+        iterator begin() {
+            return mEntries.begin();
+        }
+
+        iterator end() {
+            return mEntries.end();
+        }
+
+        const_iterator cbegin() const {
+            return mEntries.cbegin();
+        }
+
+        const_iterator cend() const {
+            return mEntries.cend();
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+    private:
+        Entries mEntries;
+        Compare mCompare;
+
+        std::size_t lower_bound_index(const Key& pKey) const {
+            ColumnSpan<const Key> keys = mEntries.template column<0>();
+            return static_cast<std::size_t>(std::lower_bound(keys.begin(), keys.end(), pKey, mCompare) - keys.begin());
+        }
+
+        bool matches(std::size_t pIdx, const Key& pKey) const {
+            return pIdx != getSize() && !mCompare(pKey, mEntries.template column<0>()[pIdx]);
+        }
+
+        // Index of the entry with pKey, or getSize() when there is none.
+        std::size_t find_index(const Key& pKey) const {
+            std::size_t idx = lower_bound_index(pKey);
+            return matches(idx, pKey) ? idx : getSize();
+        }
+
+        std::size_t checked_index(const Key& pKey) const {
+            std::size_t idx = find_index(pKey);
+            if (idx == getSize())
+                throw std::out_of_range("Key is not mapped");
+            return idx;
+        }
+
+        // Merges entries sorted by unique keys into the map, skipping keys already mapped.
+        size_type merge(value_type* pFirst, value_type* pLast) {
+            if (pFirst == pLast)
+                return 0;
+            ColumnSpan<Key> keys = mEntries.template column<0>();
+            ColumnSpan<Value> values = mEntries.template column<1>();
+            std::size_t count = getSize();
+            Entries merged;
+            merged.reserve(count + static_cast<std::size_t>(pLast - pFirst));
+            std::size_t idx = 0;
+            size_type added = 0;
+            while (idx < count && pFirst != pLast) {
+                if (mCompare(keys[idx], std::get<0>(*pFirst))) {
+                    merged.append(value_type(std::move(keys[idx]), std::move(values[idx])));
+                    ++idx;
+                }
+                else if (mCompare(std::get<0>(*pFirst), keys[idx])) {
+                    merged.append(std::move(*pFirst++));
+                    ++added;
+                }
+                else
+                    ++pFirst;
+            }
+            for (; idx < count; ++idx)
+                merged.append(value_type(std::move(keys[idx]), std::move(values[idx])));
+            for (; pFirst != pLast; ++pFirst, ++added)
+                merged.append(std::move(*pFirst));
+            mEntries = std::move(merged);
+            return added;
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_FLATMAP_H
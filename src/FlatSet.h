@@ -0,0 +1,187 @@
+#ifndef AISDI_LINEAR_FLATSET_H
+#define AISDI_LINEAR_FLATSET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "Vector.h"
+
+namespace aisdi {
+
+    /*
+     * Set of unique keys kept sorted in one Vector. Lookups binary-search contiguous memory,
+     * single inserts and erases shift the tail in O(n) and insertBatch() merges k keys in
+     * O(n + k log k). Meant for read-mostly tables that are built or updated in batches.
+     *
+     * Keys are immutable in place, both iterators are read-only.
+     */
+    template<typename Key, typename Compare = std::less<Key>>
+    class FlatSet {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using key_type = Key;
+        using value_type = Key;
+        using key_compare = Compare;
+        using const_reference = const Key&;
+        using reference = const_reference;
+
+        using const_iterator = typename Vector<Key>::const_iterator;
+        using iterator = const_iterator;
+
+        FlatSet() noexcept(std::is_nothrow_default_constructible<Compare>::value) : mKeys(), mCompare() { }
+
+        explicit FlatSet(const Compare& pCompare) : mKeys(), mCompare(pCompare) { }
+
+        FlatSet(std::initializer_list<Key> l) : FlatSet() {
+            insertBatch(l.begin(), l.end());
+        }
+
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        FlatSet(InputIt first, InputIt last) : FlatSet() {
+            insertBatch(first, last);
+        }
+
+        bool isEmpty() const {
+            return mKeys.isEmpty();
+        }
+
+        size_type getSize() const {
+            return mKeys.getSize();
+        }
+
+        // Returns false and leaves the set unchanged when an equivalent key is already present.
+        bool insert(const Key& pKey) {
+            return insert_key(pKey);
+        }
+
+        bool insert(Key&& pKey) {
+            return insert_key(std::move(pKey));
+        }
+
+        /*
+         * Inserts every key of [first, last) that is not present yet and returns how many were added.
+         * The batch is sorted and deduplicated on its own, then merged with the existing keys
+         * into a single new buffer.
+         */
+        template<typename InputIt>
+        size_type insertBatch(InputIt first, InputIt last) {
+            Vector<Key> batch(first, last);
+            Key* begin = batch.data();
+            Key* end = begin + batch.getSize();
+            std::sort(begin, end, mCompare);
+            end = std::unique(begin, end, [this](const Key& pLeft, const Key& pRight) {
+                return !mCompare(pLeft, pRight);
+            });
+            return merge(begin, end);
+        }
+
+        // Returns whether a key was erased.
+        bool erase(const Key& pKey) {
+            std::size_t idx = find_index(pKey);
+            if (idx == mKeys.getSize())
+                return false;
+            mKeys.erase(mKeys.cbegin() + idx);
+            return true;
+        }
+
+        void erase(const const_iterator& position) {
+            mKeys.erase(position);
+        }
+
+        // First key not ordered before pKey.
+        const_iterator lower_bound(const Key& pKey) const {
+            return mKeys.cbegin() + lower_bound_index(pKey);
+        }
+
+        const_iterator find(const Key& pKey) const {
+            return mKeys.cbegin() + find_index(pKey);
+        }
+
+        bool contains(const Key& pKey) const {
+            return find_index(pKey) != mKeys.getSize();
+        }
+
+        // Keys in ascending order, contiguous until the next insert or erase.
+        const Key* data() const {
+            return mKeys.data();
+        }
+
+        const_iterator begin() const {
+            return mKeys.cbegin();
+        }
+
+        const_iterator end() const {
+            return mKeys.cend();
+        }
+
+        const_iterator cbegin() const {
+            return mKeys.cbegin();
+        }
+
+        const_iterator cend() const {
+            return mKeys.cend();
+        }
+
+    private:
+        Vector<Key> mKeys;
+        Compare mCompare;
+
+        std::size_t lower_bound_index(const Key& pKey) const {
+            const Key* keys = mKeys.data();
+            return static_cast<std::size_t>(std::lower_bound(keys, keys + mKeys.getSize(), pKey, mCompare) - keys);
+        }
+
+        // Index of the key equivalent to pKey, or getSize() when there is none.
+        std::size_t find_index(const Key& pKey) const {
+            std::size_t idx = lower_bound_index(pKey);
+            if (idx != mKeys.getSize() && mCompare(pKey, mKeys.data()[idx]))
+                return mKeys.getSize();
+            return idx;
+        }
+
+        template<typename Value>
+        bool insert_key(Value&& pKey) {
+            std::size_t idx = lower_bound_index(pKey);
+            if (idx != mKeys.getSize() && !mCompare(pKey, mKeys.data()[idx]))
+                return false;
+            mKeys.insert(mKeys.cbegin() + idx, std::forward<Value>(pKey));
+            return true;
+        }
+
+        // Merges sorted, unique [pFirst, pLast) into the keys, skipping those already present.
+        size_type merge(Key* pFirst, Key* pLast) {
+            if (pFirst == pLast)
+                return 0;
+            Key* keys = mKeys.data();
+            std::size_t count = mKeys.getSize();
+            Vector<Key> merged;
+            merged.reserve(count + static_cast<std::size_t>(pLast - pFirst));
+            std::size_t idx = 0;
+            size_type added = 0;
+            while (idx < count && pFirst != pLast) {
+                if (mCompare(keys[idx], *pFirst))
+                    merged.append(std::move(keys[idx++]));
+                else if (mCompare(*pFirst, keys[idx])) {
+                    merged.append(std::move(*pFirst++));
+                    ++added;
+                }
+                else
+                    ++pFirst;
+            }
+            for (; idx < count; ++idx)
+                merged.append(std::move(keys[idx]));
+            for (; pFirst != pLast; ++pFirst, ++added)
+                merged.append(std::move(*pFirst));
+            mKeys = std::move(merged);
+            return added;
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_FLATSET_H
@@ -0,0 +1,320 @@
+#ifndef AISDI_LINEAR_FORWARDLIST_H
+#define AISDI_LINEAR_FORWARDLIST_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi {
+
+    /*
+     * Singly linked list: one link per node, O(1) append through a tail pointer and O(1) popFirst.
+     * Positions are addressed by the node before them, as in insertAfter and eraseAfter;
+     * beforeBegin() allows touching the first element that way.
+     */
+    template<typename Type>
+    class ForwardList {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type*;
+        using reference = Type&;
+        using const_pointer = const Type*;
+        using const_reference = const Type&;
+
+        class ConstIterator;
+
+        friend class ConstIterator;
+
+        class Iterator;
+
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        struct Link;
+        struct Node;
+
+        // The before-begin link is a member, so empty and moved-from lists own no memory.
+        ForwardList() noexcept : mBeforeBegin{nullptr}, mLast(&mBeforeBegin), mCount(0) { }
+
+        ForwardList(std::initializer_list<Type> l) : ForwardList() {
+            for (auto&& element : l)
+                append(element);
+        }
+
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        ForwardList(InputIt first, InputIt last) : ForwardList() {
+            for (; first != last; ++first)
+                append(*first);
+        }
+
+        ForwardList(const ForwardList& other) : ForwardList() {
+            for (auto&& element : other)
+                append(element);
+        }
+
+        ForwardList(ForwardList&& other) noexcept : ForwardList() {
+            take(other);
+        }
+
+        ~ForwardList() {
+            clear();
+        }
+
+        ForwardList& operator=(const ForwardList& other) {
+            if (this == &other)
+                return *this;
+            clear();
+            for (auto&& element : other)
+                append(element);
+            return *this;
+        }
+
+        ForwardList& operator=(ForwardList&& other) noexcept {
+            if (this != &other) {
+                clear();
+                take(other);
+            }
+            return *this;
+        }
+
+        bool isEmpty() const {
+            return mCount == 0;
+        }
+
+        size_type getSize() const {
+            return mCount;
+        }
+
+        void append(const Type& item) {
+            link_after(mLast, item);
+        }
+
+        void append(Type&& item) {
+            link_after(mLast, std::move(item));
+        }
+
+        void prepend(const Type& item) {
+            link_after(&mBeforeBegin, item);
+        }
+
+        void prepend(Type&& item) {
+            link_after(&mBeforeBegin, std::move(item));
+        }
+
+        void insertAfter(const const_iterator& position, const Type& item) {
+            link_after(checked(position), item);
+        }
+
+        void insertAfter(const const_iterator& position, Type&& item) {
+            link_after(checked(position), std::move(item));
+        }
+
+        Type popFirst() {
+            if (mCount == 0)
+                throw std::out_of_range("Popping from empty list");
+            Type item = std::move(static_cast<Node*>(mBeforeBegin.next)->data);
+            unlink_after(&mBeforeBegin);
+            return item;
+        }
+
+        void eraseAfter(const const_iterator& position) {
+            Link* link = checked(position);
+            if (link->next == nullptr)
+                throw std::out_of_range("Nothing to erase after the last element");
+            unlink_after(link);
+        }
+
+        iterator beforeBegin() {
+            return Iterator(*this, &mBeforeBegin);
+        }
+
+        iterator begin() {
+            return Iterator(*this, mBeforeBegin.next);
+        }
+
+        iterator end() {
+            return Iterator(*this, nullptr);
+        }
+
+        const_iterator cbeforeBegin() const {
+            return ConstIterator(*this, const_cast<Link*>(&mBeforeBegin));
+        }
+
+        const_iterator cbegin() const {
+            return ConstIterator(*this, mBeforeBegin.next);
+        }
+
+        const_iterator cend() const {
+            return ConstIterator(*this, nullptr);
+        }
+
+        const_iterator beforeBegin() const {
+            return cbeforeBegin();
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+    private:
+        Link mBeforeBegin;
+        Link* mLast;
+        std::size_t mCount;
+
+        Link* checked(const const_iterator& pPosition) const {
+            if (pPosition.mLink == nullptr)
+                throw std::out_of_range("Using end iterator as position");
+            return pPosition.mLink;
+        }
+
+        template<typename Value>
+        void link_after(Link* pPrev, Value&& pItem) {
+            Node* node = new Node(pPrev->next, std::forward<Value>(pItem));
+            pPrev->next = node;
+            if (mLast == pPrev)
+                mLast = node;
+            ++mCount;
+        }
+
+        void unlink_after(Link* pPrev) {
+            Node* node = static_cast<Node*>(pPrev->next);
+            pPrev->next = node->next;
+            if (mLast == node)
+                mLast = pPrev;
+            delete node;
+            --mCount;
+        }
+
+        // Moves all nodes of pOther, which is left empty, into this empty list.
+        void take(ForwardList& pOther) noexcept {
+            if (pOther.mCount == 0)
+                return;
+            mBeforeBegin.next = pOther.mBeforeBegin.next;
+            mLast = pOther.mLast;
+            mCount = pOther.mCount;
+            pOther.mBeforeBegin.next = nullptr;
+            pOther.mLast = &pOther.mBeforeBegin;
+            pOther.mCount = 0;
+        }
+
+        void clear() {
+            Link* link = mBeforeBegin.next;
+            while (link != nullptr) {
+                Node* node = static_cast<Node*>(link);
+                link = link->next;
+                delete node;
+            }
+            mBeforeBegin.next = nullptr;
+            mLast = &mBeforeBegin;
+            mCount = 0;
+        }
+    };
+
+    template<typename Type>
+    struct ForwardList<Type>::Link {
+        Link* next;
+    };
+
+    template<typename Type>
+    struct ForwardList<Type>::Node : public ForwardList<Type>::Link {
+        template<typename Value>
+        Node(Link* pNext, Value&& pItem) : Link{pNext}, data(std::forward<Value>(pItem)) { }
+
+        Type data;
+    };
+
+    template<typename Type>
+    class ForwardList<Type>::ConstIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename ForwardList::value_type;
+        using difference_type = typename ForwardList::difference_type;
+        using pointer = typename ForwardList::const_pointer;
+        using reference = typename ForwardList::const_reference;
+
+        friend class ForwardList<Type>;
+
+        explicit ConstIterator(const ForwardList& pList, Link* pLink) : mList(pList), mLink(pLink) { }
+
+        reference operator*() const {
+            if (mLink == nullptr || mLink == &mList.mBeforeBegin)
+                throw std::out_of_range("Dereferencing invalid iterator");
+            return static_cast<Node*>(mLink)->data;
+        }
+
+        ConstIterator& operator++() {
+            if (mLink == nullptr)
+                throw std::out_of_range("Trying to increment end iterator");
+            mLink = mLink->next;
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator copy(*this);
+            operator++();
+            return copy;
+        }
+
+        // Stops at end() when the list is shorter than d.
+        ConstIterator operator+(difference_type d) const {
+            Link* link = mLink;
+            for (difference_type offset = 0; link != nullptr && offset < d; ++offset)
+                link = link->next;
+            return ConstIterator(mList, link);
+        }
+
+        bool operator==(const ConstIterator& other) const {
+            return mLink == other.mLink;
+        }
+
+        bool operator!=(const ConstIterator& other) const {
+            return !operator==(other);
+        }
+
+    protected:
+        const ForwardList& mList;
+        Link* mLink;
+    };
+
+    template<typename Type>
+    class ForwardList<Type>::Iterator : public ForwardList<Type>::ConstIterator {
+    public:
+        using pointer = typename ForwardList::pointer;
+        using reference = typename ForwardList::reference;
+
+        explicit Iterator(const ForwardList& pList, Link* pLink) : ConstIterator(pList, pLink) { }
+
+        Iterator(const ConstIterator& other) : ConstIterator(other) { }
+
+        Iterator& operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        reference operator*() const {
+            // ugly cast, yet reduces code duplication.
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_FORWARDLIST_H
@@ -0,0 +1,369 @@
+#ifndef AISDI_LINEAR_GAPVECTOR_H
+#define AISDI_LINEAR_GAPVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi {
+
+    /*
+     * Gap buffer: elements live in one array split by a movable gap of unused slots.
+     * The gap follows the last edit, so inserting or erasing next to the previous edit is O(1)
+     * and jumping elsewhere costs O(distance) element moves.
+     *
+     * Logical index i is stored at mData[i] before the gap and at mData[i + gapSize] after it.
+     */
+    template<typename Type>
+    class GapVector {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type*;
+        using reference = Type&;
+        using const_pointer = const Type*;
+        using const_reference = const Type&;
+
+        class ConstIterator;
+
+        class Iterator;
+
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        // Storage is allocated by the first insert, empty and moved-from buffers own no memory.
+        GapVector() noexcept : mCapacity(0), mGapBegin(0), mGapEnd(0), mData(nullptr) { }
+
+        GapVector(std::initializer_list<Type> l) : mCapacity(l.size() * 2 + 1), mGapBegin(l.size()),
+                                                   mGapEnd(mCapacity), mData(new Type[mCapacity]) {
+            std::size_t idx = 0;
+            for (auto&& elem : l)
+                mData[idx++] = elem;
+        }
+
+        GapVector(const GapVector& other) : mCapacity(other.getSize() + other.getSize() / 2 + 1),
+                                            mGapBegin(other.getSize()), mGapEnd(mCapacity),
+                                            mData(new Type[mCapacity]) {
+            other.copyTo(mData);
+        }
+
+        GapVector(GapVector&& other) noexcept : GapVector() {
+            swap(other);
+        }
+
+        ~GapVector() {
+            delete[] mData;
+        }
+
+        GapVector& operator=(const GapVector& other) {
+            if (this == &other)
+                return *this;
+            if (mCapacity < other.getSize() + 1) {
+                GapVector copy(other);
+                swap(copy);
+                return *this;
+            }
+            other.copyTo(mData);
+            mGapBegin = other.getSize();
+            mGapEnd = mCapacity;
+            return *this;
+        }
+
+        GapVector& operator=(GapVector&& other) noexcept {
+            GapVector tmp(std::move(other));
+            swap(tmp);
+            return *this;
+        }
+
+        bool isEmpty() const {
+            return getSize() == 0;
+        }
+
+        size_type getSize() const {
+            return mCapacity - gapSize();
+        }
+
+        void append(const Type& item) {
+            insert_at(item, getSize());
+        }
+
+        void append(Type&& item) {
+            insert_at(std::move(item), getSize());
+        }
+
+        void prepend(const Type& item) {
+            insert_at(item, 0);
+        }
+
+        void prepend(Type&& item) {
+            insert_at(std::move(item), 0);
+        }
+
+        void insert(const const_iterator& insertPosition, const Type& item) {
+            insert_at(item, insertPosition.mIndex);
+        }
+
+        void insert(const const_iterator& insertPosition, Type&& item) {
+            insert_at(std::move(item), insertPosition.mIndex);
+        }
+
+        Type popFirst() {
+            if (isEmpty()) throw std::out_of_range("Can not popFirst, gap vector is empty");
+            Type item = std::move(at(0));
+            erase_at(0, 1);
+            return item;
+        }
+
+        Type popLast() {
+            if (isEmpty()) throw std::out_of_range("Can not popLast, gap vector is empty");
+            Type item = std::move(at(getSize() - 1));
+            erase_at(getSize() - 1, 1);
+            return item;
+        }
+
+        void erase(const const_iterator& position) {
+            if (position.mIndex >= getSize())
+                throw std::out_of_range("Erasing out of range");
+            erase_at(position.mIndex, 1);
+        }
+
+        void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded) {
+            std::size_t first = firstIncluded.mIndex;
+            std::size_t last = lastExcluded.mIndex;
+
+            if (last > getSize() || first > last)
+                throw std::out_of_range("Erasing end");
+
+            erase_at(first, last - first);
+        }
+
+        iterator begin() {
+            return Iterator(*this, 0);
+        }
+
+        iterator end() {
+            return Iterator(*this, getSize());
+        }
+
+        const_iterator cbegin() const {
+            return ConstIterator(*this, 0);
+        }
+
+        const_iterator cend() const {
+            return ConstIterator(*this, getSize());
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+    private:
+        static const std::size_t INIT_CAPACITY = 16;
+        std::size_t mCapacity;
+        std::size_t mGapBegin;
+        std::size_t mGapEnd;
+        Type* mData;
+
+        friend class ConstIterator;
+
+        std::size_t gapSize() const {
+            return mGapEnd - mGapBegin;
+        }
+
+        Type& at(std::size_t pIdx) const {
+            return mData[pIdx < mGapBegin ? pIdx : pIdx + gapSize()];
+        }
+
+        void swap(GapVector& other) noexcept {
+            std::swap(mCapacity, other.mCapacity);
+            std::swap(mGapBegin, other.mGapBegin);
+            std::swap(mGapEnd, other.mGapEnd);
+            std::swap(mData, other.mData);
+        }
+
+        // Writes live elements into pDest without the gap.
+        void copyTo(Type* pDest) const {
+            std::copy(mData, mData + mGapBegin, pDest);
+            std::copy(mData + mGapEnd, mData + mCapacity, pDest + mGapBegin);
+        }
+
+        void moveGap(std::size_t pPosition) {
+            if (pPosition < mGapBegin) {
+                std::move_backward(mData + pPosition, mData + mGapBegin, mData + mGapEnd);
+                mGapEnd -= mGapBegin - pPosition;
+                mGapBegin = pPosition;
+            }
+            else if (pPosition > mGapBegin) {
+                std::size_t distance = pPosition - mGapBegin;
+                std::move(mData + mGapEnd, mData + mGapEnd + distance, mData + mGapBegin);
+                mGapBegin += distance;
+                mGapEnd += distance;
+            }
+        }
+
+        // Grows the buffer, leaving the new gap at pPosition.
+        void realocate(std::size_t pPosition) {
+            std::size_t size = getSize();
+            std::size_t capacity = mCapacity * 2;
+            if (capacity < INIT_CAPACITY)
+                capacity = INIT_CAPACITY;
+            Type* tmp = new Type[capacity];
+            for (std::size_t idx = 0; idx < pPosition; ++idx)
+                tmp[idx] = std::move(at(idx));
+            std::size_t tail = capacity - (size - pPosition);
+            for (std::size_t idx = pPosition; idx < size; ++idx)
+                tmp[tail + idx - pPosition] = std::move(at(idx));
+            delete[] mData;
+            mData = tmp;
+            mCapacity = capacity;
+            mGapBegin = pPosition;
+            mGapEnd = tail;
+        }
+
+        template<typename Value>
+        void insert_at(Value&& pValue, std::size_t pPosition) {
+            if (pPosition > getSize())
+                throw std::out_of_range("Inserting out of range");
+            if (mGapBegin == mGapEnd)
+                realocate(pPosition);
+            else
+                moveGap(pPosition);
+            mData[mGapBegin++] = std::forward<Value>(pValue);
+        }
+
+        void erase_at(std::size_t pIdx, std::size_t pCount) {
+            moveGap(pIdx);
+            mGapEnd += pCount;
+        }
+    };
+
+    template<typename Type>
+    class GapVector<Type>::ConstIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename GapVector::value_type;
+        using difference_type = typename GapVector::difference_type;
+        using pointer = typename GapVector::const_pointer;
+        using reference = typename GapVector::const_reference;
+
+        friend class GapVector<Type>;
+
+        explicit ConstIterator(const GapVector<Type>& pVector, std::size_t pIdx) : mVector(pVector), mIndex(pIdx) { }
+
+        ConstIterator(const ConstIterator& pOther) : mVector(pOther.mVector), mIndex(pOther.mIndex) { }
+
+        reference operator*() const {
+            if (mIndex == mVector.getSize())
+                throw std::out_of_range("Dereferencing end iterator");
+            return mVector.at(mIndex);
+        }
+
+        ConstIterator& operator++() {
+            if (mIndex == mVector.getSize())
+                throw std::out_of_range("Iterator out of range");
+            ++mIndex;
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator it(*this);
+            operator++();
+            return it;
+        }
+
+        ConstIterator& operator--() {
+            if (mIndex == 0)
+                throw std::out_of_range("Iterator out of range");
+            --mIndex;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            ConstIterator it(*this);
+            operator--();
+            return it;
+        }
+
+        ConstIterator operator+(difference_type d) const {
+            std::size_t new_idx = mIndex + d;
+            if (new_idx >= mVector.getSize())
+                return ConstIterator(mVector, mVector.getSize());
+            return ConstIterator(mVector, new_idx);
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            if (mIndex < (std::size_t) d)
+                throw std::out_of_range("Iterator out of range");
+            return ConstIterator(mVector, mIndex - d);
+        }
+
+        bool operator==(const ConstIterator& other) const {
+            return (mIndex == other.mIndex) && (&mVector == &other.mVector);
+        }
+
+        bool operator!=(const ConstIterator& other) const {
+            return !operator==(other);
+        }
+
+    protected:
+        const GapVector<Type>& mVector;
+        std::size_t mIndex;
+    };
+
+    template<typename Type>
+    class GapVector<Type>::Iterator : public GapVector<Type>::ConstIterator {
+    public:
+        using pointer = typename GapVector::pointer;
+        using reference = typename GapVector::reference;
+
+        explicit Iterator(const GapVector<Type>& pVector, std::size_t pIdx) : ConstIterator(pVector, pIdx) { }
+
+        Iterator(const ConstIterator& other) : ConstIterator(other) { }
+
+        Iterator& operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator& operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        reference operator*() const {
+            // ugly cast, yet reduces code duplication.
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_GAPVECTOR_H
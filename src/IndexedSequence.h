@@ -0,0 +1,773 @@
+#ifndef AISDI_LINEAR_INDEXEDSEQUENCE_H
+#define AISDI_LINEAR_INDEXEDSEQUENCE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi {
+
+    /*
+     * Sequence stored in a B+tree whose inner nodes keep the element count of every subtree.
+     * Positional insert, erase, lookup, split and concat are O(log n); leaves are chained,
+     * so iterating is O(1) amortized per step.
+     *
+     * Leaves hold a few cache lines worth of elements, inner nodes hold INNER_CAPACITY children.
+     * Every node but the root is at least half full.
+     */
+    template<typename Type>
+    class IndexedSequence {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = Type;
+        using pointer = Type*;
+        using reference = Type&;
+        using const_pointer = const Type*;
+        using const_reference = const Type&;
+
+        class ConstIterator;
+
+        class Iterator;
+
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        IndexedSequence() noexcept : mRoot(nullptr), mHeight(0), mCount(0) { }
+
+        IndexedSequence(std::initializer_list<Type> l) : IndexedSequence() {
+            for (auto&& elem : l)
+                append(elem);
+        }
+
+        IndexedSequence(const IndexedSequence& other) : IndexedSequence() {
+            for (auto&& elem : other)
+                append(elem);
+        }
+
+        IndexedSequence(IndexedSequence&& other) noexcept : IndexedSequence() {
+            swap(other);
+        }
+
+        ~IndexedSequence() {
+            destroy(mRoot);
+        }
+
+        IndexedSequence& operator=(const IndexedSequence& other) {
+            if (this == &other)
+                return *this;
+            IndexedSequence copy(other);
+            swap(copy);
+            return *this;
+        }
+
+        IndexedSequence& operator=(IndexedSequence&& other) noexcept {
+            IndexedSequence tmp(std::move(other));
+            swap(tmp);
+            return *this;
+        }
+
+        bool isEmpty() const {
+            return mCount == 0;
+        }
+
+        size_type getSize() const {
+            return mCount;
+        }
+
+        void append(const Type& item) {
+            insert_at(item, mCount);
+        }
+
+        void append(Type&& item) {
+            insert_at(std::move(item), mCount);
+        }
+
+        void prepend(const Type& item) {
+            insert_at(item, 0);
+        }
+
+        void prepend(Type&& item) {
+            insert_at(std::move(item), 0);
+        }
+
+        void insert(const const_iterator& insertPosition, const Type& item) {
+            insert_at(item, insertPosition.mIndex);
+        }
+
+        void insert(const const_iterator& insertPosition, Type&& item) {
+            insert_at(std::move(item), insertPosition.mIndex);
+        }
+
+        Type popFirst() {
+            if (mCount == 0) throw std::out_of_range("Can not popFirst, sequence is empty");
+            Type item = std::move(*begin());
+            erase_at(0);
+            return item;
+        }
+
+        Type popLast() {
+            if (mCount == 0) throw std::out_of_range("Can not popLast, sequence is empty");
+            Type item = std::move(*(end() - 1));
+            erase_at(mCount - 1);
+            return item;
+        }
+
+        void erase(const const_iterator& position) {
+            erase_at(position.mIndex);
+        }
+
+        void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded) {
+            std::size_t first = firstIncluded.mIndex;
+            std::size_t last = lastExcluded.mIndex;
+
+            if (last > mCount || first > last)
+                throw std::out_of_range("Erasing end");
+            if (first == last)
+                return;
+
+            IndexedSequence tail = split_at(last);
+            split_at(first);
+            concat(tail);
+        }
+
+        // Moves elements from position to the end into the returned sequence.
+        IndexedSequence split(const const_iterator& position) {
+            return split_at(position.mIndex);
+        }
+
+        // Moves all elements of other to the end of this sequence, leaving other empty.
+        void concat(IndexedSequence& other) {
+            if (this == &other)
+                throw std::invalid_argument("Can not concat sequence with itself");
+            Tree joined = join(Tree{mRoot, mHeight}, Tree{other.mRoot, other.mHeight});
+            mRoot = joined.root;
+            mHeight = joined.height;
+            mCount += other.mCount;
+            other.mRoot = nullptr;
+            other.mHeight = 0;
+            other.mCount = 0;
+        }
+
+        iterator begin() {
+            return Iterator(*this, 0);
+        }
+
+        iterator end() {
+            return Iterator(*this, mCount);
+        }
+
+        const_iterator cbegin() const {
+            return ConstIterator(*this, 0);
+        }
+
+        const_iterator cend() const {
+            return ConstIterator(*this, mCount);
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+    private:
+        static const std::size_t CACHE_LINE = 64;
+        static const std::size_t LEAF_CAPACITY = 4 * CACHE_LINE / sizeof(Type) > 4 ? 4 * CACHE_LINE / sizeof(Type) : 4;
+        static const std::size_t INNER_CAPACITY = 16;
+
+        struct Node {
+            bool isLeaf;
+            std::size_t count;
+
+            explicit Node(bool pIsLeaf) : isLeaf(pIsLeaf), count(0) { }
+        };
+
+        struct Leaf : public Node {
+            Leaf* prev;
+            Leaf* next;
+            Type items[LEAF_CAPACITY];
+
+            Leaf() : Node(true), prev(nullptr), next(nullptr) { }
+        };
+
+        struct Inner : public Node {
+            std::size_t sizes[INNER_CAPACITY];
+            Node* children[INNER_CAPACITY];
+
+            Inner() : Node(false) { }
+        };
+
+        struct Tree {
+            Node* root;
+            int height;
+        };
+
+        Node* mRoot;
+        int mHeight;
+        std::size_t mCount;
+
+        friend class ConstIterator;
+
+        static Leaf* asLeaf(Node* pNode) {
+            return static_cast<Leaf*>(pNode);
+        }
+
+        static Inner* asInner(Node* pNode) {
+            return static_cast<Inner*>(pNode);
+        }
+
+        static std::size_t capacityOf(Node* pNode) {
+            if (pNode->isLeaf)
+                return LEAF_CAPACITY;
+            return INNER_CAPACITY;
+        }
+
+        static std::size_t sizeOf(Node* pNode) {
+            if (pNode->isLeaf)
+                return pNode->count;
+            std::size_t size = 0;
+            for (std::size_t idx = 0; idx < pNode->count; ++idx)
+                size += asInner(pNode)->sizes[idx];
+            return size;
+        }
+
+        static void deleteNode(Node* pNode) {
+            if (pNode->isLeaf)
+                delete asLeaf(pNode);
+            else
+                delete asInner(pNode);
+        }
+
+        static void destroy(Node* pNode) {
+            if (pNode == nullptr)
+                return;
+            if (!pNode->isLeaf)
+                for (std::size_t idx = 0; idx < pNode->count; ++idx)
+                    destroy(asInner(pNode)->children[idx]);
+            deleteNode(pNode);
+        }
+
+        static Leaf* firstLeaf(Node* pNode) {
+            while (!pNode->isLeaf)
+                pNode = asInner(pNode)->children[0];
+            return asLeaf(pNode);
+        }
+
+        static Leaf* lastLeaf(Node* pNode) {
+            while (!pNode->isLeaf)
+                pNode = asInner(pNode)->children[pNode->count - 1];
+            return asLeaf(pNode);
+        }
+
+        void swap(IndexedSequence& other) noexcept {
+            std::swap(mRoot, other.mRoot);
+            std::swap(mHeight, other.mHeight);
+            std::swap(mCount, other.mCount);
+        }
+
+        // Returns the leaf holding element pIdx and its slot there, or nullptr for the end position.
+        Leaf* locate(std::size_t pIdx, std::size_t& pSlot) const {
+            pSlot = 0;
+            if (pIdx >= mCount)
+                return nullptr;
+            Node* node = mRoot;
+            while (!node->isLeaf) {
+                Inner* inner = asInner(node);
+                std::size_t child = 0;
+                while (pIdx >= inner->sizes[child])
+                    pIdx -= inner->sizes[child++];
+                node = inner->children[child];
+            }
+            pSlot = pIdx;
+            return asLeaf(node);
+        }
+
+        // Inserts pChild at pPosition, splitting pNode when it is full. Returns the new right sibling.
+        static Inner* insertChild(Inner* pNode, std::size_t pPosition, Node* pChild) {
+            if (pNode->count < INNER_CAPACITY) {
+                for (std::size_t idx = pNode->count; idx > pPosition; --idx) {
+                    pNode->children[idx] = pNode->children[idx - 1];
+                    pNode->sizes[idx] = pNode->sizes[idx - 1];
+                }
+                pNode->children[pPosition] = pChild;
+                pNode->sizes[pPosition] = sizeOf(pChild);
+                ++pNode->count;
+                return nullptr;
+            }
+
+            const std::size_t half = INNER_CAPACITY / 2;
+            Inner* right = new Inner;
+            std::copy(pNode->children + half, pNode->children + INNER_CAPACITY, right->children);
+            std::copy(pNode->sizes + half, pNode->sizes + INNER_CAPACITY, right->sizes);
+            right->count = INNER_CAPACITY - half;
+            pNode->count = half;
+            if (pPosition <= half)
+                insertChild(pNode, pPosition, pChild);
+            else
+                insertChild(right, pPosition - half, pChild);
+            return right;
+        }
+
+        // Inserts into the subtree of pNode. Returns the new right sibling when pNode had to split.
+        template<typename Value>
+        static Node* insertRec(Node* pNode, std::size_t pIdx, Value&& pValue) {
+            if (pNode->isLeaf) {
+                Leaf* leaf = asLeaf(pNode);
+                if (leaf->count < LEAF_CAPACITY) {
+                    std::move_backward(leaf->items + pIdx, leaf->items + leaf->count, leaf->items + leaf->count + 1);
+                    leaf->items[pIdx] = std::forward<Value>(pValue);
+                    ++leaf->count;
+                    return nullptr;
+                }
+
+                const std::size_t half = LEAF_CAPACITY / 2;
+                Leaf* right = new Leaf;
+                std::move(leaf->items + half, leaf->items + LEAF_CAPACITY, right->items);
+                right->count = LEAF_CAPACITY - half;
+                leaf->count = half;
+                right->next = leaf->next;
+                if (right->next != nullptr)
+                    right->next->prev = right;
+                right->prev = leaf;
+                leaf->next = right;
+                if (pIdx <= half)
+                    insertRec(leaf, pIdx, std::forward<Value>(pValue));
+                else
+                    insertRec(right, pIdx - half, std::forward<Value>(pValue));
+                return right;
+            }
+
+            Inner* inner = asInner(pNode);
+            std::size_t child = 0;
+            while (child + 1 < inner->count && pIdx > inner->sizes[child])
+                pIdx -= inner->sizes[child++];
+            Node* split = insertRec(inner->children[child], pIdx, std::forward<Value>(pValue));
+            if (split == nullptr) {
+                ++inner->sizes[child];
+                return nullptr;
+            }
+            inner->sizes[child] = sizeOf(inner->children[child]);
+            return insertChild(inner, child + 1, split);
+        }
+
+        /*
+         * Balances two adjacent nodes of the same height. When both fit in one node, pRight is merged
+         * into pLeft and deleted (returns true); otherwise elements are split evenly between them.
+         */
+        static bool mergeOrRedistribute(Node* pLeft, Node* pRight) {
+            std::size_t total = pLeft->count + pRight->count;
+            if (pLeft->isLeaf) {
+                Leaf* left = asLeaf(pLeft);
+                Leaf* right = asLeaf(pRight);
+                if (total <= LEAF_CAPACITY) {
+                    std::move(right->items, right->items + right->count, left->items + left->count);
+                    left->count = total;
+                    left->next = right->next;
+                    if (left->next != nullptr)
+                        left->next->prev = left;
+                    delete right;
+                    return true;
+                }
+                std::size_t target = total / 2;
+                if (left->count > target) {
+                    std::size_t moved = left->count - target;
+                    std::move_backward(right->items, right->items + right->count,
+                                       right->items + right->count + moved);
+                    std::move(left->items + target, left->items + left->count, right->items);
+                }
+                else if (left->count < target) {
+                    std::size_t moved = target - left->count;
+                    std::move(right->items, right->items + moved, left->items + left->count);
+                    std::move(right->items + moved, right->items + right->count, right->items);
+                }
+                left->count = target;
+                right->count = total - target;
+                return false;
+            }
+
+            Inner* left = asInner(pLeft);
+            Inner* right = asInner(pRight);
+            if (total <= INNER_CAPACITY) {
+                std::copy(right->children, right->children + right->count, left->children + left->count);
+                std::copy(right->sizes, right->sizes + right->count, left->sizes + left->count);
+                left->count = total;
+                delete right;
+                return true;
+            }
+            std::size_t target = total / 2;
+            if (left->count > target) {
+                std::size_t moved = left->count - target;
+                std::copy_backward(right->children, right->children + right->count,
+                                   right->children + right->count + moved);
+                std::copy_backward(right->sizes, right->sizes + right->count, right->sizes + right->count + moved);
+                std::copy(left->children + target, left->children + left->count, right->children);
+                std::copy(left->sizes + target, left->sizes + left->count, right->sizes);
+            }
+            else {
+                std::size_t moved = target - left->count;
+                std::copy(right->children, right->children + moved, left->children + left->count);
+                std::copy(right->sizes, right->sizes + moved, left->sizes + left->count);
+                std::copy(right->children + moved, right->children + right->count, right->children);
+                std::copy(right->sizes + moved, right->sizes + right->count, right->sizes);
+            }
+            left->count = target;
+            right->count = total - target;
+            return false;
+        }
+
+        static void eraseRec(Node* pNode, std::size_t pIdx) {
+            if (pNode->isLeaf) {
+                Leaf* leaf = asLeaf(pNode);
+                std::move(leaf->items + pIdx + 1, leaf->items + leaf->count, leaf->items + pIdx);
+                --leaf->count;
+                return;
+            }
+
+            Inner* inner = asInner(pNode);
+            std::size_t child = 0;
+            while (pIdx >= inner->sizes[child])
+                pIdx -= inner->sizes[child++];
+            Node* node = inner->children[child];
+            eraseRec(node, pIdx);
+            --inner->sizes[child];
+            if (node->count >= capacityOf(node) / 2)
+                return;
+
+            std::size_t left = child > 0 ? child - 1 : child;
+            if (mergeOrRedistribute(inner->children[left], inner->children[left + 1])) {
+                inner->sizes[left] += inner->sizes[left + 1];
+                for (std::size_t idx = left + 1; idx + 1 < inner->count; ++idx) {
+                    inner->children[idx] = inner->children[idx + 1];
+                    inner->sizes[idx] = inner->sizes[idx + 1];
+                }
+                --inner->count;
+            }
+            else {
+                inner->sizes[left] = sizeOf(inner->children[left]);
+                inner->sizes[left + 1] = sizeOf(inner->children[left + 1]);
+            }
+        }
+
+        // Drops empty roots and inner roots with a single child.
+        static Tree normalize(Tree pTree) {
+            while (pTree.root != nullptr && !pTree.root->isLeaf && pTree.root->count <= 1) {
+                Node* child = pTree.root->count == 0 ? nullptr : asInner(pTree.root)->children[0];
+                delete asInner(pTree.root);
+                pTree.root = child;
+                --pTree.height;
+            }
+            if (pTree.root != nullptr && pTree.root->count == 0) {
+                delete asLeaf(pTree.root);
+                pTree.root = nullptr;
+            }
+            if (pTree.root == nullptr)
+                pTree.height = 0;
+            return pTree;
+        }
+
+        // Clears leaf links pointing outside of the tree.
+        static void detach(Tree pTree) {
+            if (pTree.root == nullptr)
+                return;
+            firstLeaf(pTree.root)->prev = nullptr;
+            lastLeaf(pTree.root)->next = nullptr;
+        }
+
+        // Hangs pRight (lower) on the right spine of pNode. Returns the new right sibling of pNode.
+        static Node* joinRight(Node* pNode, int pHeight, Node* pRight, int pRightHeight) {
+            Inner* inner = asInner(pNode);
+            std::size_t last = inner->count - 1;
+            Node* child = inner->children[last];
+            Node* sibling = pRight;
+            if (pHeight > pRightHeight + 1)
+                sibling = joinRight(child, pHeight - 1, pRight, pRightHeight);
+            else if (mergeOrRedistribute(child, pRight))
+                sibling = nullptr;
+            inner->sizes[last] = sizeOf(child);
+            return sibling == nullptr ? nullptr : insertChild(inner, last + 1, sibling);
+        }
+
+        // Hangs pLeft (lower) on the left spine of pNode. Returns the new right sibling of pNode.
+        static Node* joinLeft(Node* pLeft, int pLeftHeight, Node* pNode, int pHeight) {
+            Inner* inner = asInner(pNode);
+            Node* child = inner->children[0];
+            Node* sibling = nullptr;
+            if (pHeight > pLeftHeight + 1) {
+                sibling = joinLeft(pLeft, pLeftHeight, child, pHeight - 1);
+            }
+            else {
+                if (!mergeOrRedistribute(pLeft, child))
+                    sibling = child;
+                inner->children[0] = pLeft;
+            }
+            inner->sizes[0] = sizeOf(inner->children[0]);
+            return sibling == nullptr ? nullptr : insertChild(inner, 1, sibling);
+        }
+
+        static Tree join(Tree pLeft, Tree pRight) {
+            if (pLeft.root == nullptr)
+                return pRight;
+            if (pRight.root == nullptr)
+                return pLeft;
+
+            detach(pLeft);
+            detach(pRight);
+            Leaf* leftEnd = lastLeaf(pLeft.root);
+            Leaf* rightBegin = firstLeaf(pRight.root);
+            leftEnd->next = rightBegin;
+            rightBegin->prev = leftEnd;
+
+            Tree result = pLeft;
+            Node* sibling = nullptr;
+            if (pLeft.height == pRight.height) {
+                if (!mergeOrRedistribute(pLeft.root, pRight.root))
+                    sibling = pRight.root;
+            }
+            else if (pLeft.height > pRight.height) {
+                sibling = joinRight(pLeft.root, pLeft.height, pRight.root, pRight.height);
+            }
+            else {
+                result = pRight;
+                sibling = joinLeft(pLeft.root, pLeft.height, pRight.root, pRight.height);
+            }
+
+            if (sibling != nullptr) {
+                Inner* root = new Inner;
+                insertChild(root, 0, result.root);
+                insertChild(root, 1, sibling);
+                result.root = root;
+                ++result.height;
+            }
+            return result;
+        }
+
+        // Splits the subtree of pNode into elements before pIdx and the rest.
+        static std::pair<Tree, Tree> splitRec(Node* pNode, int pHeight, std::size_t pIdx) {
+            if (pNode->isLeaf) {
+                Leaf* leaf = asLeaf(pNode);
+                Leaf* right = new Leaf;
+                std::move(leaf->items + pIdx, leaf->items + leaf->count, right->items);
+                right->count = leaf->count - pIdx;
+                leaf->count = pIdx;
+                leaf->next = nullptr;
+                return std::make_pair(normalize(Tree{leaf, 0}), normalize(Tree{right, 0}));
+            }
+
+            Inner* inner = asInner(pNode);
+            std::size_t child = 0;
+            while (pIdx >= inner->sizes[child])
+                pIdx -= inner->sizes[child++];
+
+            Inner* right = new Inner;
+            std::copy(inner->children + child + 1, inner->children + inner->count, right->children);
+            std::copy(inner->sizes + child + 1, inner->sizes + inner->count, right->sizes);
+            right->count = inner->count - child - 1;
+            Node* middle = inner->children[child];
+            inner->count = child;
+
+            std::pair<Tree, Tree> parts = splitRec(middle, pHeight - 1, pIdx);
+            return std::make_pair(join(normalize(Tree{inner, pHeight}), parts.first),
+                                  join(parts.second, normalize(Tree{right, pHeight})));
+        }
+
+        IndexedSequence split_at(std::size_t pIdx) {
+            if (pIdx > mCount)
+                throw std::out_of_range("Splitting out of range");
+            IndexedSequence tail;
+            if (pIdx == mCount)
+                return tail;
+            if (pIdx == 0) {
+                swap(tail);
+                return tail;
+            }
+
+            std::pair<Tree, Tree> parts = splitRec(mRoot, mHeight, pIdx);
+            detach(parts.first);
+            detach(parts.second);
+            mRoot = parts.first.root;
+            mHeight = parts.first.height;
+            tail.mRoot = parts.second.root;
+            tail.mHeight = parts.second.height;
+            tail.mCount = mCount - pIdx;
+            mCount = pIdx;
+            return tail;
+        }
+
+        template<typename Value>
+        void insert_at(Value&& pValue, std::size_t pPosition) {
+            if (pPosition > mCount)
+                throw std::out_of_range("Inserting out of range");
+            if (mRoot == nullptr) {
+                mRoot = new Leaf;
+                mHeight = 0;
+            }
+            Node* sibling = insertRec(mRoot, pPosition, std::forward<Value>(pValue));
+            if (sibling != nullptr) {
+                Inner* root = new Inner;
+                insertChild(root, 0, mRoot);
+                insertChild(root, 1, sibling);
+                mRoot = root;
+                ++mHeight;
+            }
+            ++mCount;
+        }
+
+        void erase_at(std::size_t pIdx) {
+            if (pIdx >= mCount)
+                throw std::out_of_range("Erasing out of range");
+            eraseRec(mRoot, pIdx);
+            --mCount;
+            Tree tree = normalize(Tree{mRoot, mHeight});
+            mRoot = tree.root;
+            mHeight = tree.height;
+        }
+    };
+
+    template<typename Type>
+    class IndexedSequence<Type>::ConstIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename IndexedSequence::value_type;
+        using difference_type = typename IndexedSequence::difference_type;
+        using pointer = typename IndexedSequence::const_pointer;
+        using reference = typename IndexedSequence::const_reference;
+
+        friend class IndexedSequence<Type>;
+
+        explicit ConstIterator(const IndexedSequence<Type>& pSequence, std::size_t pIdx)
+                : mSequence(pSequence), mIndex(pIdx) {
+            mLeaf = mSequence.locate(mIndex, mSlot);
+        }
+
+        ConstIterator(const ConstIterator& pOther) : mSequence(pOther.mSequence), mIndex(pOther.mIndex),
+                                                     mLeaf(pOther.mLeaf), mSlot(pOther.mSlot) { }
+
+        reference operator*() const {
+            if (mLeaf == nullptr)
+                throw std::out_of_range("Dereferencing end iterator");
+            return mLeaf->items[mSlot];
+        }
+
+        ConstIterator& operator++() {
+            if (mLeaf == nullptr)
+                throw std::out_of_range("Iterator out of range");
+            ++mIndex;
+            if (++mSlot == mLeaf->count) {
+                mLeaf = mLeaf->next;
+                mSlot = 0;
+            }
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator it(*this);
+            operator++();
+            return it;
+        }
+
+        ConstIterator& operator--() {
+            if (mIndex == 0)
+                throw std::out_of_range("Iterator out of range");
+            --mIndex;
+            if (mLeaf == nullptr) {
+                mLeaf = mSequence.locate(mIndex, mSlot);
+            }
+            else if (mSlot == 0) {
+                mLeaf = mLeaf->prev;
+                mSlot = mLeaf->count - 1;
+            }
+            else {
+                --mSlot;
+            }
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            ConstIterator it(*this);
+            operator--();
+            return it;
+        }
+
+        ConstIterator operator+(difference_type d) const {
+            std::size_t new_idx = mIndex + d;
+            if (new_idx >= mSequence.mCount)
+                return ConstIterator(mSequence, mSequence.mCount);
+            return ConstIterator(mSequence, new_idx);
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            if (mIndex < (std::size_t) d)
+                throw std::out_of_range("Iterator out of range");
+            return ConstIterator(mSequence, mIndex - d);
+        }
+
+        bool operator==(const ConstIterator& other) const {
+            return (mIndex == other.mIndex) && (&mSequence == &other.mSequence);
+        }
+
+        bool operator!=(const ConstIterator& other) const {
+            return !operator==(other);
+        }
+
+    protected:
+        const IndexedSequence<Type>& mSequence;
+        std::size_t mIndex;
+        Leaf* mLeaf;
+        std::size_t mSlot;
+    };
+
+    template<typename Type>
+    class IndexedSequence<Type>::Iterator : public IndexedSequence<Type>::ConstIterator {
+    public:
+        using pointer = typename IndexedSequence::pointer;
+        using reference = typename IndexedSequence::reference;
+
+        explicit Iterator(const IndexedSequence<Type>& pSequence, std::size_t pIdx) : ConstIterator(pSequence, pIdx) { }
+
+        Iterator(const ConstIterator& other) : ConstIterator(other) { }
+
+        Iterator& operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator& operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        reference operator*() const {
+            // ugly cast, yet reduces code duplication.
+            return const_cast<reference>(ConstIterator::operator*());
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_INDEXEDSEQUENCE_H
@@ -2,13 +2,18 @@
 #define AISDI_LINEAR_LINKEDLIST_H
 
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <new>
 #include <stdexcept>
+#include <utility>
+#include "ContainerStats.h"
 
 namespace aisdi {
 
     template<typename Type>
-    class LinkedList {
+    class LinkedList : public ContainerStats {
     public:
         using difference_type = std::ptrdiff_t;
         using size_type = std::size_t;
@@ -30,65 +35,85 @@ namespace aisdi {
         struct Node;
         struct NodeExtended;
 
-        LinkedList() : mCount(0) {
-            mHead = new Node(nullptr, nullptr);
-            mTail = new Node(nullptr, nullptr);
-            mHead->next = mTail;
-            mTail->prev = mHead;
-        }
+        /*
+         * Stable reference to an element, valid until the element is erased; splices do not move it.
+         * Unlike iterators, handles are assignable, so indexes over the list can store them.
+         */
+        class Handle {
+        public:
+            Handle() : mNode(nullptr) { }
+
+            explicit operator bool() const {
+                return mNode != nullptr;
+            }
+
+            bool operator==(const Handle& other) const {
+                return mNode == other.mNode;
+            }
+
+            bool operator!=(const Handle& other) const {
+                return mNode != other.mNode;
+            }
+
+        private:
+            friend class LinkedList<Type>;
+
+            explicit Handle(Node* pNode) : mNode(pNode) { }
+
+            Node* mNode;
+        };
+
+        // Sentinels are members, so empty and moved-from lists own no memory.
+        LinkedList() noexcept : mHead(nullptr, &mTail), mTail(&mHead, nullptr), mCount(0), mSlabs(nullptr),
+                                mFreeSlots(nullptr) { }
 
         LinkedList(std::initializer_list<Type> l) : LinkedList() {
-            for (auto&& element : l)
-                append(std::forward<decltype(element)>(element));
-            mCount = l.size();
+            append_range(l.begin(), l.end(), std::forward_iterator_tag());
+        }
+
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        LinkedList(InputIt first, InputIt last) : LinkedList() {
+            append_range(first, last, typename std::iterator_traits<InputIt>::iterator_category());
         }
 
         LinkedList(const LinkedList& other) : LinkedList() {
-            for (auto&& element : other)
-                append(element);
-            mCount = other.mCount;
+            append_range(other.cbegin(), other.cend(), std::forward_iterator_tag());
         }
 
-        LinkedList(LinkedList&& other) : LinkedList() {
-            Node* head = mHead;
-            Node* tail = mTail;
-            mHead = std::move(other.mHead);
-            mTail = std::move(other.mTail);
-            mCount = std::move(other.mCount);
-            other.mHead = head;
-            other.mTail = tail;
-            other.mCount = 0;
+        LinkedList(LinkedList&& other) noexcept : LinkedList() {
+            take(other);
         }
 
         ~LinkedList() {
             clear();
-            delete mHead;
-            delete mTail;
         }
 
         LinkedList& operator=(const LinkedList& other) {
-            clear();
-            for (auto&& element : other)
-                append(element);
-            mCount = other.mCount;
+            if (this != &other)
+                assign(other.cbegin(), other.cend());
             return *this;
         }
 
-        LinkedList& operator=(LinkedList&& other) {
-            clear();
-            Node* head = mHead;
-            Node* tail = mTail;
-            mHead = std::move(other.mHead);
-            mTail = std::move(other.mTail);
-            mCount = std::move(other.mCount);
-            other.mHead = head;
-            other.mTail = tail;
-            other.mCount = 0;
+        LinkedList& operator=(LinkedList&& other) noexcept {
+            if (this != &other) {
+                clear();
+                take(other);
+            }
             return *this;
         }
 
+        /*
+         * Replaces the contents with [first, last), which must not point into this list.
+         * Nodes of a forward range are carved out of a single allocation.
+         */
+        template<typename InputIt>
+        void assign(InputIt first, InputIt last) {
+            clear();
+            append_range(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+        }
+
         bool isEmpty() const {
-            return (mHead->next == mTail);
+            return (head()->next == tail());
         }
 
         size_type getSize() const {
@@ -99,44 +124,53 @@ namespace aisdi {
             insert(end(), item);
         }
 
+        void append(Type&& item) {
+            insert(end(), std::move(item));
+        }
+
         void prepend(const Type& item) {
             insert(begin(), item);
         }
 
+        void prepend(Type&& item) {
+            insert(begin(), std::move(item));
+        }
+
         void insert(const const_iterator& insertPosition, const Type& item) {
-            Node* before = insertPosition.mNode;
-            Node* node = new NodeExtended(before->prev, before, item);
-            before->prev->next = node;
-            before->prev = node;
-            ++mCount;
+            insert_before(insertPosition.mNode, item);
+        }
+
+        void insert(const const_iterator& insertPosition, Type&& item) {
+            insert_before(insertPosition.mNode, std::move(item));
         }
 
         Type popFirst() {
-            if (mHead->next == mTail)
+            if (head()->next == tail())
                 throw std::out_of_range("Popping from empty list");
 
-            Type ret = dynamic_cast<NodeExtended*>(mHead->next)->data;
+            Type ret = std::move(static_cast<NodeExtended*>(head()->next)->data);
             erase(begin());
             return ret;
         }
 
         Type popLast() {
-            if (mHead->next == mTail)
+            if (head()->next == tail())
                 throw std::out_of_range("Popping from empty list");
 
-            Type ret = dynamic_cast<NodeExtended*>(mTail->prev)->data;
+            Type ret = std::move(static_cast<NodeExtended*>(tail()->prev)->data);
             erase(--end());
             return ret;
         }
 
         void erase(const const_iterator& possition) {
             Node* node = possition.mNode;
-            if (node == mTail)
+            if (node == tail())
                 throw std::out_of_range("Removing end of list");
             node->prev->next = node->next;
             node->next->prev = node->prev;
-            delete node;
+            release(node);
             --mCount;
+            countErase(1);
         }
 
         void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded) {
@@ -152,25 +186,63 @@ namespace aisdi {
             while (first != last) {
                 node = first;
                 first = first->next;
-                delete node;
+                release(node);
                 --mCount;
+                countErase(1);
             }
         }
 
+        /*
+         * Moves the element at pElement before pPosition by relinking its node: nothing is allocated,
+         * copied or freed, and iterators to the element stay valid.
+         */
+        void splice(const const_iterator& pPosition, const const_iterator& pElement) {
+            Node* node = pElement.mNode;
+            Node* before = pPosition.mNode;
+            if (node == tail())
+                throw std::out_of_range("Moving end of list");
+            if (node == before || node->next == before)
+                return;
+            node->prev->next = node->next;
+            node->next->prev = node->prev;
+            node->prev = before->prev;
+            node->next = before;
+            before->prev->next = node;
+            before->prev = node;
+        }
+
+        Handle getHandle(const const_iterator& pPosition) const {
+            if (pPosition.mNode == tail() || pPosition.mNode == head())
+                throw std::out_of_range("Handle of invalid iterator");
+            return Handle(pPosition.mNode);
+        }
+
+        const_iterator getIterator(const Handle& pHandle) const {
+            return ConstIterator(*this, pHandle.mNode);
+        }
+
+        reference get(const Handle& pHandle) {
+            return static_cast<NodeExtended*>(pHandle.mNode)->data;
+        }
+
+        const_reference get(const Handle& pHandle) const {
+            return static_cast<NodeExtended*>(pHandle.mNode)->data;
+        }
+
         iterator begin() {
-            return Iterator(*this, mHead->next);
+            return Iterator(*this, head()->next);
         }
 
         iterator end() {
-            return Iterator(*this, mTail);
+            return Iterator(*this, tail());
         }
 
         const_iterator cbegin() const {
-            return ConstIterator(*this, mHead->next);
+            return ConstIterator(*this, head()->next);
         }
 
         const_iterator cend() const {
-            return ConstIterator(*this, mTail);
+            return ConstIterator(*this, tail());
         }
 
         const_iterator begin() const {
@@ -182,21 +254,148 @@ namespace aisdi {
         }
 
     private:
-        Node* mHead;
-        Node* mTail;
+        /*
+         * Nodes built by bulk copies live in slabs: a header followed by room for capacity nodes.
+         * Erased slab nodes go to mFreeSlots and are reused by later inserts; slabs themselves
+         * are only freed by clear() and the destructor.
+         */
+        struct Slab {
+            Slab* next;
+            std::size_t capacity;
+        };
+
+        struct FreeSlot {
+            FreeSlot* next;
+        };
+
+        Node mHead;
+        Node mTail;
         std::size_t mCount;
+        Slab* mSlabs;
+        FreeSlot* mFreeSlots;
+
+        // Header size rounded up, so nodes following it stay aligned.
+        static std::size_t slabHeader() {
+            return (sizeof(Slab) + alignof(NodeExtended) - 1) / alignof(NodeExtended) * alignof(NodeExtended);
+        }
+
+        // Sentinel addresses for iterators, which only hold a const reference to the list.
+        Node* head() const {
+            return const_cast<Node*>(&mHead);
+        }
+
+        Node* tail() const {
+            return const_cast<Node*>(&mTail);
+        }
+
+        // Moves all nodes and slabs of pOther, which is left empty, into this empty list.
+        void take(LinkedList& pOther) noexcept {
+            if (pOther.mHead.next != &pOther.mTail) {
+                mHead.next = pOther.mHead.next;
+                mHead.next->prev = &mHead;
+                mTail.prev = pOther.mTail.prev;
+                mTail.prev->next = &mTail;
+                pOther.mHead.next = &pOther.mTail;
+                pOther.mTail.prev = &pOther.mHead;
+            }
+            mCount = pOther.mCount;
+            pOther.mCount = 0;
+            std::swap(mSlabs, pOther.mSlabs);
+            std::swap(mFreeSlots, pOther.mFreeSlots);
+        }
+
+        static char* slotsOf(Slab* pSlab) {
+            return reinterpret_cast<char*>(pSlab) + slabHeader();
+        }
+
+        bool inSlab(const Node* pNode) const {
+            std::less<const void*> less;
+            for (Slab* slab = mSlabs; slab != nullptr; slab = slab->next) {
+                const char* slots = slotsOf(slab);
+                if (!less(pNode, slots) && less(pNode, slots + slab->capacity * sizeof(NodeExtended)))
+                    return true;
+            }
+            return false;
+        }
+
+        // Makes the next pCount inserts take consecutive nodes of one new slab.
+        void reserveSlab(std::size_t pCount) {
+            if (pCount == 0)
+                return;
+            Slab* slab = static_cast<Slab*>(::operator new(slabHeader() + pCount * sizeof(NodeExtended)));
+            slab->next = mSlabs;
+            slab->capacity = pCount;
+            mSlabs = slab;
+            for (std::size_t idx = pCount; idx > 0; --idx)
+                mFreeSlots = new(slotsOf(slab) + (idx - 1) * sizeof(NodeExtended)) FreeSlot{mFreeSlots};
+        }
+
+        template<typename Value>
+        Node* create(Node* pPrev, Node* pNext, Value&& pItem) {
+            if (mFreeSlots == nullptr)
+                return new NodeExtended(pPrev, pNext, std::forward<Value>(pItem));
+            FreeSlot* slot = mFreeSlots;
+            mFreeSlots = slot->next;
+            return new(static_cast<void*>(slot)) NodeExtended(pPrev, pNext, std::forward<Value>(pItem));
+        }
+
+        void release(Node* pNode) {
+            NodeExtended* node = static_cast<NodeExtended*>(pNode);
+            if (!inSlab(pNode)) {
+                delete node;
+                return;
+            }
+            node->~NodeExtended();
+            mFreeSlots = new(static_cast<void*>(pNode)) FreeSlot{mFreeSlots};
+        }
+
+        template<typename ForwardIt>
+        void append_range(ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+            reserveSlab(static_cast<std::size_t>(std::distance(first, last)));
+            for (; first != last; ++first)
+                insert_before(tail(), *first);
+        }
+
+        template<typename InputIt>
+        void append_range(InputIt first, InputIt last, std::input_iterator_tag) {
+            for (; first != last; ++first)
+                insert_before(tail(), *first);
+        }
+
+        template<typename Value>
+        void insert_before(Node* before, Value&& item) {
+            if (before == tail())
+                countAppend();
+            else if (before->prev == head())
+                countPrepend();
+            else
+                countMiddleInsert();
+            Node* node = create(before->prev, before, std::forward<Value>(item));
+            before->prev->next = node;
+            before->prev = node;
+            ++mCount;
+        }
 
         void clear() {
-            if (mCount == 0) return;
-            Node* node = mHead->next;
-            while (node != mTail) {
+            Node* node = head()->next;
+            while (node != tail()) {
                 Node* tmp = node;
                 node = node->next;
-                delete tmp;
+                if (inSlab(tmp))
+                    static_cast<NodeExtended*>(tmp)->~NodeExtended();
+                else
+                    delete static_cast<NodeExtended*>(tmp);
             }
-            mHead->next = mTail;
-            mTail->prev = mHead;
+            mHead.next = &mTail;
+            mTail.prev = &mHead;
             mCount = 0;
+
+            while (mSlabs != nullptr) {
+                Slab* slab = mSlabs;
+                mSlabs = slab->next;
+                ::operator delete(slab);
+            }
+            mFreeSlots = nullptr;
         }
     };
 
@@ -206,8 +405,6 @@ namespace aisdi {
         Node* next;
 
         Node(Node* pPrev, Node* pNext) : prev(pPrev), next(pNext) { };
-
-        virtual ~Node() { }
     };
 
     template<typename Type>
@@ -217,8 +414,6 @@ namespace aisdi {
         NodeExtended(Node* pPrev, Node* pNext, const Type& pData) : Node(pPrev, pNext), data(pData) { };
 
         NodeExtended(Node* pPrev, Node* pNext, Type&& pData) : Node(pPrev, pNext), data(std::move(pData)) { };
-
-        virtual ~NodeExtended() { }
     };
 
     template<typename Type>
@@ -235,13 +430,13 @@ namespace aisdi {
         explicit ConstIterator(const LinkedList& pList, Node* pNode) : mList(pList), mNode(pNode) { }
 
         reference operator*() const {
-            if (mNode == mList.mTail || mNode == mList.mHead)
+            if (mNode == mList.tail() || mNode == mList.head())
                 throw std::out_of_range("Dereferencing invalid iterator");
-            return dynamic_cast<NodeExtended*>(mNode)->data;
+            return static_cast<NodeExtended*>(mNode)->data;
         }
 
         ConstIterator& operator++() {
-            if (mNode == mList.mTail)
+            if (mNode == mList.tail())
                 throw std::out_of_range("Trying to increment end iterator");
             mNode = mNode->next;
             return *this;
@@ -254,7 +449,7 @@ namespace aisdi {
         }
 
         ConstIterator& operator--() {
-            if (mNode->prev == mList.mHead)
+            if (mNode->prev == mList.head())
                 throw std::out_of_range("Trying to decrement end iterator");
             mNode = mNode->prev;
             return *this;
@@ -269,20 +464,22 @@ namespace aisdi {
         ConstIterator operator+(difference_type d) const {
             Node* node = mNode;
             difference_type offset = 0;
-            while (node != mList.mTail && offset - d < 0) {
+            while (node != mList.tail() && offset - d < 0) {
                 node = node->next;
                 ++offset;
             }
+            mList.countSteps(offset);
             return ConstIterator(mList, node);
         }
 
         ConstIterator operator-(difference_type d) const {
             Node* node = mNode;
             difference_type offset = 0;
-            while (node != mList.mHead && offset - d < 0) {
+            while (node != mList.head() && offset - d < 0) {
                 node = node->prev;
                 ++offset;
             }
+            mList.countSteps(offset);
             return ConstIterator(mList, node);
         }
 
@@ -297,6 +494,7 @@ namespace aisdi {
     protected:
         const LinkedList& mList;
         Node* mNode;
+
     };
 
     template<typename Type>
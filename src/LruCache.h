@@ -0,0 +1,300 @@
+#ifndef AISDI_LINEAR_LRUCACHE_H
+#define AISDI_LINEAR_LRUCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include "LinkedList.h"
+
+namespace aisdi {
+
+    /*
+     * Least recently used cache of at most getCapacity() entries. Entries live in a LinkedList,
+     * most recently used first, and an open addressing table maps keys to list handles.
+     *
+     * get(), touch() and updating put() relink one node to the front of the list. Once the cache
+     * is full, a put() of a new key reuses the node of the least recently used entry, so a warm
+     * cache allocates nothing. Evicted entries are passed to the eviction callback first, which
+     * must not use the cache.
+     */
+    template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class LruCache {
+    public:
+        using size_type = std::size_t;
+        using key_type = Key;
+        using mapped_type = Value;
+
+        struct Entry {
+            Key key;
+            Value value;
+            std::size_t hash;
+        };
+
+        using value_type = Entry;
+        using const_iterator = typename LinkedList<Entry>::const_iterator;
+        using iterator = const_iterator;
+        using EvictionCallback = std::function<void(const Key&, Value&)>;
+
+        // The table is allocated by the first put, empty and moved-from caches own no memory.
+        explicit LruCache(size_type pCapacity, EvictionCallback pOnEvict = EvictionCallback())
+                : mEntries(), mBuckets(nullptr), mShift(0), mCapacity(pCapacity), mHash(), mEqual(),
+                  mOnEvict(std::move(pOnEvict)) {
+            if (pCapacity == 0)
+                throw std::invalid_argument("Cache capacity must be positive");
+        }
+
+        // Copies entries and their order, least recently used first.
+        LruCache(const LruCache& other) : LruCache(other.mCapacity, other.mOnEvict) {
+            for (auto it = other.mEntries.cend(); it != other.mEntries.cbegin();) {
+                --it;
+                put((*it).key, (*it).value);
+            }
+        }
+
+        LruCache(LruCache&& other) noexcept : mEntries(), mBuckets(nullptr), mShift(0),
+                                              mCapacity(other.mCapacity), mHash(), mEqual(), mOnEvict() {
+            swap(other);
+        }
+
+        ~LruCache() {
+            delete[] mBuckets;
+        }
+
+        LruCache& operator=(const LruCache& other) {
+            if (this != &other) {
+                LruCache copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        LruCache& operator=(LruCache&& other) noexcept {
+            if (this != &other) {
+                LruCache moved(std::move(other));
+                swap(moved);
+            }
+            return *this;
+        }
+
+        void swap(LruCache& other) noexcept {
+            std::swap(mEntries, other.mEntries);
+            std::swap(mBuckets, other.mBuckets);
+            std::swap(mShift, other.mShift);
+            std::swap(mCapacity, other.mCapacity);
+            std::swap(mHash, other.mHash);
+            std::swap(mEqual, other.mEqual);
+            std::swap(mOnEvict, other.mOnEvict);
+        }
+
+        bool isEmpty() const {
+            return mEntries.isEmpty();
+        }
+
+        size_type getSize() const {
+            return mEntries.getSize();
+        }
+
+        size_type getCapacity() const {
+            return mCapacity;
+        }
+
+        void setEvictionCallback(EvictionCallback pOnEvict) {
+            mOnEvict = std::move(pOnEvict);
+        }
+
+        // Value of pKey marked as most recently used, nullptr when the key is not cached.
+        Value* get(const Key& pKey) {
+            Handle handle = find(pKey);
+            if (!handle)
+                return nullptr;
+            moveToFront(handle);
+            return &mEntries.get(handle).value;
+        }
+
+        // Value of pKey without changing the order, nullptr when the key is not cached.
+        const Value* peek(const Key& pKey) const {
+            Handle handle = find(pKey);
+            return handle ? &mEntries.get(handle).value : nullptr;
+        }
+
+        bool contains(const Key& pKey) const {
+            return static_cast<bool>(find(pKey));
+        }
+
+        // Marks pKey as most recently used, returns false when it is not cached.
+        bool touch(const Key& pKey) {
+            Handle handle = find(pKey);
+            if (!handle)
+                return false;
+            moveToFront(handle);
+            return true;
+        }
+
+        // Inserts or updates pKey as the most recently used entry, evicting the least recently used one when full.
+        void put(const Key& pKey, const Value& pValue) {
+            put_value(pKey, pValue);
+        }
+
+        void put(const Key& pKey, Value&& pValue) {
+            put_value(pKey, std::move(pValue));
+        }
+
+        // Returns whether pKey was cached. The eviction callback is not called.
+        bool erase(const Key& pKey) {
+            std::size_t bucket = find_bucket(pKey, mHash(pKey));
+            if (bucket == NO_BUCKET)
+                return false;
+            Handle handle = mBuckets[bucket];
+            erase_bucket(bucket);
+            mEntries.erase(mEntries.getIterator(handle));
+            return true;
+        }
+
+        // Evicts up to pCount least recently used entries and returns how many were evicted.
+        size_type evictN(size_type pCount) {
+            size_type evicted = 0;
+            for (; evicted < pCount && !isEmpty(); ++evicted) {
+                Handle handle = evict();
+                mEntries.erase(mEntries.getIterator(handle));
+            }
+            return evicted;
+        }
+
+        // Entries from the most to the least recently used.
+        const_iterator begin() const {
+            return mEntries.cbegin();
+        }
+
+        const_iterator end() const {
+            return mEntries.cend();
+        }
+
+        const_iterator cbegin() const {
+            return mEntries.cbegin();
+        }
+
+        const_iterator cend() const {
+            return mEntries.cend();
+        }
+
+    private:
+        using List = LinkedList<Entry>;
+        using Handle = typename List::Handle;
+
+        static const std::size_t NO_BUCKET = static_cast<std::size_t>(-1);
+
+        List mEntries;          // most recently used first
+        Handle* mBuckets;       // at most half full, linear probing
+        unsigned mShift;        // 64 - log2 of the bucket count
+        size_type mCapacity;
+        Hash mHash;
+        KeyEqual mEqual;
+        EvictionCallback mOnEvict;
+
+        std::size_t bucketMask() const {
+            return (std::size_t(1) << (64 - mShift)) - 1;
+        }
+
+        // Fibonacci hashing spreads weak hashes, std::hash of integers is the identity.
+        std::size_t home(std::size_t pHash) const {
+            return static_cast<std::size_t>((static_cast<std::uint64_t>(pHash) * 0x9E3779B97F4A7C15ull) >> mShift);
+        }
+
+        void allocateBuckets() {
+            unsigned bits = 1;
+            while ((std::size_t(1) << bits) < 2 * mCapacity)
+                ++bits;
+            mBuckets = new Handle[std::size_t(1) << bits];
+            mShift = 64 - bits;
+        }
+
+        std::size_t find_bucket(const Key& pKey, std::size_t pHash) const {
+            if (mBuckets == nullptr)
+                return NO_BUCKET;
+            std::size_t mask = bucketMask();
+            for (std::size_t bucket = home(pHash); mBuckets[bucket]; bucket = (bucket + 1) & mask) {
+                const Entry& candidate = mEntries.get(mBuckets[bucket]);
+                if (candidate.hash == pHash && mEqual(candidate.key, pKey))
+                    return bucket;
+            }
+            return NO_BUCKET;
+        }
+
+        Handle find(const Key& pKey) const {
+            std::size_t bucket = find_bucket(pKey, mHash(pKey));
+            return bucket == NO_BUCKET ? Handle() : mBuckets[bucket];
+        }
+
+        void insert_bucket(Handle pHandle) {
+            std::size_t mask = bucketMask();
+            std::size_t bucket = home(mEntries.get(pHandle).hash);
+            while (mBuckets[bucket])
+                bucket = (bucket + 1) & mask;
+            mBuckets[bucket] = pHandle;
+        }
+
+        // Backward shift deletion: later entries of the probe run move into the hole if it is on their path.
+        void erase_bucket(std::size_t pBucket) {
+            std::size_t mask = bucketMask();
+            std::size_t hole = pBucket;
+            for (std::size_t bucket = (hole + 1) & mask; mBuckets[bucket]; bucket = (bucket + 1) & mask) {
+                std::size_t wanted = home(mEntries.get(mBuckets[bucket]).hash);
+                if (((bucket - wanted) & mask) >= ((bucket - hole) & mask)) {
+                    mBuckets[hole] = mBuckets[bucket];
+                    hole = bucket;
+                }
+            }
+            mBuckets[hole] = Handle();
+        }
+
+        void moveToFront(Handle pHandle) {
+            mEntries.splice(mEntries.cbegin(), mEntries.getIterator(pHandle));
+        }
+
+        // Hands the least recently used entry to the callback and unmaps it, its node stays in the list.
+        Handle evict() {
+            Handle handle = mEntries.getHandle(--mEntries.cend());
+            Entry& victim = mEntries.get(handle);
+            if (mOnEvict)
+                mOnEvict(victim.key, victim.value);
+            erase_bucket(find_bucket(victim.key, victim.hash));
+            return handle;
+        }
+
+        template<typename Item>
+        void put_value(const Key& pKey, Item&& pValue) {
+            std::size_t hash = mHash(pKey);
+            std::size_t bucket = find_bucket(pKey, hash);
+            if (bucket != NO_BUCKET) {
+                mEntries.get(mBuckets[bucket]).value = std::forward<Item>(pValue);
+                moveToFront(mBuckets[bucket]);
+                return;
+            }
+            if (mBuckets == nullptr)
+                allocateBuckets();
+
+            Handle handle;
+            if (getSize() == mCapacity) {
+                handle = evict();
+                Entry& reused = mEntries.get(handle);
+                reused.key = pKey;
+                reused.value = std::forward<Item>(pValue);
+                reused.hash = hash;
+                moveToFront(handle);
+            }
+            else {
+                mEntries.prepend(Entry{pKey, std::forward<Item>(pValue), hash});
+                handle = mEntries.getHandle(mEntries.cbegin());
+            }
+            insert_bucket(handle);
+        }
+    };
+
+    template<typename Key, typename Value, typename Hash, typename KeyEqual>
+    const std::size_t LruCache<Key, Value, Hash, KeyEqual>::NO_BUCKET;
+
+}
+
+#endif // AISDI_LINEAR_LRUCACHE_H
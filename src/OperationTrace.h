@@ -0,0 +1,285 @@
+#ifndef AISDI_LINEAR_OPERATIONTRACE_H
+#define AISDI_LINEAR_OPERATIONTRACE_H
+
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aisdi {
+
+    enum class TraceOperation {
+        Append, Prepend, Insert, PopFirst, PopLast, Erase, EraseRange
+    };
+
+    /*
+     * One mutating container operation. Positions are indices at the time of the operation,
+     * payload is the size in bytes of the inserted element (see payloadSize).
+     */
+    struct TraceEntry {
+        TraceOperation operation;
+        std::size_t position;
+        std::size_t length;   // erased elements for EraseRange, 1 for other erases, 0 for inserts
+        std::size_t payload;
+    };
+
+    inline bool operator==(const TraceEntry& lhs, const TraceEntry& rhs) {
+        return lhs.operation == rhs.operation && lhs.position == rhs.position
+               && lhs.length == rhs.length && lhs.payload == rhs.payload;
+    }
+
+    inline bool operator!=(const TraceEntry& lhs, const TraceEntry& rhs) {
+        return !(lhs == rhs);
+    }
+
+    inline const char* toString(TraceOperation pOperation) {
+        switch (pOperation) {
+            case TraceOperation::Append: return "append";
+            case TraceOperation::Prepend: return "prepend";
+            case TraceOperation::Insert: return "insert";
+            case TraceOperation::PopFirst: return "pop-first";
+            case TraceOperation::PopLast: return "pop-last";
+            case TraceOperation::Erase: return "erase";
+            case TraceOperation::EraseRange: return "erase-range";
+        }
+        return "unknown";
+    }
+
+    // Throws std::invalid_argument for unknown names.
+    inline TraceOperation parseTraceOperation(const std::string& pName) {
+        const TraceOperation operations[] = {
+            TraceOperation::Append, TraceOperation::Prepend, TraceOperation::Insert, TraceOperation::PopFirst,
+            TraceOperation::PopLast, TraceOperation::Erase, TraceOperation::EraseRange
+        };
+        for (TraceOperation operation : operations)
+            if (pName == toString(operation))
+                return operation;
+        throw std::invalid_argument("Unknown trace operation " + pName);
+    }
+
+    template<typename Type>
+    std::size_t payloadSize(const Type&) {
+        return sizeof(Type);
+    }
+
+    inline std::size_t payloadSize(const std::string& pValue) {
+        return pValue.size();
+    }
+
+    /*
+     * Text format, one entry per line after the header:
+     *
+     *   aisdi-trace 1
+     *   append 0 0 4
+     *   erase-range 3 10 0
+     */
+    inline void writeTrace(std::ostream& out, const std::vector<TraceEntry>& pTrace) {
+        out << "aisdi-trace 1\n";
+        for (const TraceEntry& entry : pTrace)
+            out << toString(entry.operation) << ' ' << entry.position << ' ' << entry.length << ' '
+                << entry.payload << '\n';
+    }
+
+    /*
+     * Traces start from an empty collection; every entry is checked against the size the
+     * collection has at that point. Throws std::runtime_error on malformed or out of range entries.
+     */
+    inline std::vector<TraceEntry> readTrace(std::istream& in) {
+        std::string line;
+        if (!std::getline(in, line) || line != "aisdi-trace 1")
+            throw std::runtime_error("Not an aisdi-trace 1 file");
+
+        std::vector<TraceEntry> trace;
+        std::size_t size = 0;
+        std::size_t lineNumber = 1;
+        while (std::getline(in, line)) {
+            ++lineNumber;
+            if (line.empty())
+                continue;
+            std::istringstream fields(line);
+            std::string name;
+            TraceEntry entry;
+            if (!(fields >> name >> entry.position >> entry.length >> entry.payload))
+                throw std::runtime_error("Malformed trace entry at line " + std::to_string(lineNumber));
+            try {
+                entry.operation = parseTraceOperation(name);
+            }
+            catch (const std::invalid_argument& e) {
+                throw std::runtime_error(std::string(e.what()) + " at line " + std::to_string(lineNumber));
+            }
+
+            bool valid = true;
+            switch (entry.operation) {
+                case TraceOperation::Append:
+                case TraceOperation::Prepend:
+                case TraceOperation::Insert:
+                    valid = entry.position <= size;
+                    ++size;
+                    break;
+                case TraceOperation::PopFirst:
+                case TraceOperation::PopLast:
+                case TraceOperation::Erase:
+                    valid = entry.position < size;
+                    --size;
+                    break;
+                case TraceOperation::EraseRange:
+                    valid = entry.length <= size && entry.position <= size - entry.length;
+                    size -= valid ? entry.length : 0;
+                    break;
+            }
+            if (!valid)
+                throw std::runtime_error("Trace entry out of range at line " + std::to_string(lineNumber));
+            trace.push_back(entry);
+        }
+        return trace;
+    }
+
+    /*
+     * Drop-in wrapper with the interface of the wrapped collection, recording every mutating call.
+     * Positions of iterator based calls are found by walking from begin(), so recording costs
+     * O(position) per insert or erase on top of the operation itself.
+     */
+    template<typename Collection>
+    class Recording {
+    public:
+        using difference_type = typename Collection::difference_type;
+        using size_type = typename Collection::size_type;
+        using value_type = typename Collection::value_type;
+        using pointer = typename Collection::pointer;
+        using reference = typename Collection::reference;
+        using const_pointer = typename Collection::const_pointer;
+        using const_reference = typename Collection::const_reference;
+        using iterator = typename Collection::iterator;
+        using const_iterator = typename Collection::const_iterator;
+
+        Recording() = default;
+
+        const std::vector<TraceEntry>& getTrace() const {
+            return mTrace;
+        }
+
+        void clearTrace() {
+            mTrace.clear();
+        }
+
+        void writeTrace(std::ostream& out) const {
+            aisdi::writeTrace(out, mTrace);
+        }
+
+        bool isEmpty() const {
+            return mCollection.isEmpty();
+        }
+
+        size_type getSize() const {
+            return mCollection.getSize();
+        }
+
+        void append(const value_type& item) {
+            std::size_t payload = payloadSize(item);
+            mCollection.append(item);
+            record(TraceOperation::Append, getSize() - 1, 0, payload);
+        }
+
+        void append(value_type&& item) {
+            std::size_t payload = payloadSize(item);
+            mCollection.append(std::move(item));
+            record(TraceOperation::Append, getSize() - 1, 0, payload);
+        }
+
+        void prepend(const value_type& item) {
+            std::size_t payload = payloadSize(item);
+            mCollection.prepend(item);
+            record(TraceOperation::Prepend, 0, 0, payload);
+        }
+
+        void prepend(value_type&& item) {
+            std::size_t payload = payloadSize(item);
+            mCollection.prepend(std::move(item));
+            record(TraceOperation::Prepend, 0, 0, payload);
+        }
+
+        void insert(const const_iterator& insertPosition, const value_type& item) {
+            std::size_t index = indexOf(insertPosition);
+            std::size_t payload = payloadSize(item);
+            mCollection.insert(insertPosition, item);
+            record(TraceOperation::Insert, index, 0, payload);
+        }
+
+        void insert(const const_iterator& insertPosition, value_type&& item) {
+            std::size_t index = indexOf(insertPosition);
+            std::size_t payload = payloadSize(item);
+            mCollection.insert(insertPosition, std::move(item));
+            record(TraceOperation::Insert, index, 0, payload);
+        }
+
+        value_type popFirst() {
+            value_type item = mCollection.popFirst();
+            record(TraceOperation::PopFirst, 0, 1, 0);
+            return item;
+        }
+
+        value_type popLast() {
+            value_type item = mCollection.popLast();
+            record(TraceOperation::PopLast, getSize(), 1, 0);
+            return item;
+        }
+
+        void erase(const const_iterator& position) {
+            std::size_t index = indexOf(position);
+            mCollection.erase(position);
+            record(TraceOperation::Erase, index, 1, 0);
+        }
+
+        void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded) {
+            std::size_t first = indexOf(firstIncluded);
+            std::size_t last = first + std::distance(firstIncluded, lastExcluded);
+            mCollection.erase(firstIncluded, lastExcluded);
+            record(TraceOperation::EraseRange, first, last - first, 0);
+        }
+
+        iterator begin() {
+            return mCollection.begin();
+        }
+
+        iterator end() {
+            return mCollection.end();
+        }
+
+        const_iterator cbegin() const {
+            return mCollection.cbegin();
+        }
+
+        const_iterator cend() const {
+            return mCollection.cend();
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+    private:
+        Collection mCollection;
+        std::vector<TraceEntry> mTrace;
+
+        std::size_t indexOf(const const_iterator& pPosition) const {
+            return static_cast<std::size_t>(std::distance(mCollection.cbegin(), pPosition));
+        }
+
+        // Called after the operation succeeded, so calls that throw leave no entry.
+        void record(TraceOperation pOperation, std::size_t pPosition, std::size_t pLength, std::size_t pPayload) {
+            mTrace.push_back(TraceEntry{pOperation, pPosition, pLength, pPayload});
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_OPERATIONTRACE_H
@@ -0,0 +1,120 @@
+#ifndef AISDI_LINEAR_PERFCOUNTERS_H
+#define AISDI_LINEAR_PERFCOUNTERS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#  include <cstring>
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+namespace aisdi {
+namespace bench {
+
+    /*
+     * Hardware counters read through Linux perf_event_open, counting user space of this thread only.
+     * Events the kernel refuses (no PMU, perf_event_paranoid, containers) are skipped, so the set
+     * may end up empty; isAvailable() tells whether anything is counted.
+     */
+    class PerfCounters {
+    public:
+        PerfCounters() {
+#ifdef __linux__
+            open("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+            open("instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+            open("l1d-misses", PERF_TYPE_HW_CACHE, cacheEvent(PERF_COUNT_HW_CACHE_L1D));
+            open("llc-misses", PERF_TYPE_HW_CACHE, cacheEvent(PERF_COUNT_HW_CACHE_LL));
+            open("branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+            open("dtlb-misses", PERF_TYPE_HW_CACHE, cacheEvent(PERF_COUNT_HW_CACHE_DTLB));
+#endif
+        }
+
+        PerfCounters(const PerfCounters&) = delete;
+
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        ~PerfCounters() {
+#ifdef __linux__
+            for (const Event& event : mEvents)
+                close(event.fd);
+#endif
+        }
+
+        bool isAvailable() const {
+            return !mEvents.empty();
+        }
+
+        std::vector<std::string> getNames() const {
+            std::vector<std::string> names;
+            for (const Event& event : mEvents)
+                names.push_back(event.name);
+            return names;
+        }
+
+        void start() {
+#ifdef __linux__
+            for (const Event& event : mEvents)
+                ioctl(event.fd, PERF_EVENT_IOC_RESET, 0);
+            for (const Event& event : mEvents)
+                ioctl(event.fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+        }
+
+        // Returns counts since start() in getNames() order, scaled up when the kernel multiplexed events.
+        std::vector<double> stop() {
+            std::vector<double> values;
+#ifdef __linux__
+            for (const Event& event : mEvents)
+                ioctl(event.fd, PERF_EVENT_IOC_DISABLE, 0);
+            for (const Event& event : mEvents) {
+                std::uint64_t data[3] = {0, 0, 0}; // value, time enabled, time running
+                double value = 0;
+                if (read(event.fd, data, sizeof(data)) == static_cast<ssize_t>(sizeof(data)) && data[2] > 0)
+                    value = static_cast<double>(data[0]) * data[1] / data[2];
+                values.push_back(value);
+            }
+#endif
+            return values;
+        }
+
+    private:
+        struct Event {
+            std::string name;
+            int fd;
+        };
+
+        std::vector<Event> mEvents;
+
+#ifdef __linux__
+        static std::uint64_t cacheEvent(std::uint64_t pCache) {
+            return pCache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        }
+
+        void open(const char* pName, std::uint32_t pType, std::uint64_t pConfig) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = pType;
+            attr.config = pConfig;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            long fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+            if (fd >= 0)
+                mEvents.push_back(Event{pName, static_cast<int>(fd)});
+        }
+#endif
+    };
+
+}
+}
+
+#endif // AISDI_LINEAR_PERFCOUNTERS_H
@@ -0,0 +1,317 @@
+#ifndef AISDI_LINEAR_PRIORITYQUEUE_H
+#define AISDI_LINEAR_PRIORITYQUEUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include "Vector.h"
+
+namespace aisdi {
+
+    namespace heap {
+
+        // Implicit d-ary heap in an array: children of i are Arity * i + 1 ... Arity * i + Arity.
+        // Elements move into a hole instead of being swapped; pMoved(i) is called for every
+        // position that receives an element.
+
+        template<std::size_t Arity, typename Item, typename Less, typename Moved>
+        void siftUp(Item* pData, std::size_t pHole, Item&& pItem, Less& pLess, Moved&& pMoved) {
+            while (pHole > 0) {
+                std::size_t parent = (pHole - 1) / Arity;
+                if (!pLess(pItem, pData[parent]))
+                    break;
+                pData[pHole] = std::move(pData[parent]);
+                pMoved(pHole);
+                pHole = parent;
+            }
+            pData[pHole] = std::move(pItem);
+            pMoved(pHole);
+        }
+
+        template<std::size_t Arity, typename Item, typename Less, typename Moved>
+        void siftDown(Item* pData, std::size_t pSize, std::size_t pHole, Item&& pItem, Less& pLess,
+                      Moved&& pMoved) {
+            for (;;) {
+                std::size_t first = Arity * pHole + 1;
+                if (first >= pSize)
+                    break;
+                std::size_t last = std::min(first + Arity, pSize);
+                std::size_t best = first;
+                for (std::size_t child = first + 1; child < last; ++child) {
+                    if (pLess(pData[child], pData[best]))
+                        best = child;
+                }
+                if (!pLess(pData[best], pItem))
+                    break;
+                pData[pHole] = std::move(pData[best]);
+                pMoved(pHole);
+                pHole = best;
+            }
+            pData[pHole] = std::move(pItem);
+            pMoved(pHole);
+        }
+
+        // Floyd's bottom-up construction, O(n).
+        template<std::size_t Arity, typename Item, typename Less, typename Moved>
+        void heapify(Item* pData, std::size_t pSize, Less& pLess, Moved&& pMoved) {
+            if (pSize < 2)
+                return;
+            for (std::size_t parent = (pSize - 2) / Arity + 1; parent-- > 0;) {
+                Item item = std::move(pData[parent]);
+                siftDown<Arity>(pData, pSize, parent, std::move(item), pLess, pMoved);
+            }
+        }
+
+        struct NoTracking {
+            void operator()(std::size_t) const { }
+        };
+
+    }
+
+    /*
+     * Priority queue kept as an implicit d-ary heap in a Vector. top() is the least element according
+     * to Compare, so the default queue is a min-heap (unlike std::priority_queue).
+     *
+     * Arity 4 halves the heap height and keeps the four children of a node adjacent, within one or two
+     * cache lines for small elements, at the price of more comparisons per level on the way down.
+     */
+    template<typename Type, typename Compare = std::less<Type>, std::size_t Arity = 2>
+    class PriorityQueue {
+        static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+    public:
+        using size_type = std::size_t;
+        using value_type = Type;
+        using reference = Type&;
+        using const_reference = const Type&;
+
+        PriorityQueue() : mItems(), mCompare() { }
+
+        explicit PriorityQueue(const Compare& pCompare) : mItems(), mCompare(pCompare) { }
+
+        PriorityQueue(std::initializer_list<Type> l) : PriorityQueue(l.begin(), l.end()) { }
+
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        PriorityQueue(InputIt first, InputIt last, const Compare& pCompare = Compare())
+                : mItems(first, last), mCompare(pCompare) {
+            heap::heapify<Arity>(mItems.data(), mItems.getSize(), mCompare, heap::NoTracking());
+        }
+
+        bool isEmpty() const {
+            return mItems.isEmpty();
+        }
+
+        size_type getSize() const {
+            return mItems.getSize();
+        }
+
+        void reserve(size_type pCapacity) {
+            mItems.reserve(pCapacity);
+        }
+
+        const Type& top() const {
+            if (isEmpty())
+                throw std::out_of_range("Can not take top, queue is empty");
+            return mItems.data()[0];
+        }
+
+        void push(const Type& item) {
+            push(Type(item));
+        }
+
+        void push(Type&& item) {
+            mItems.append(std::move(item));
+            size_type hole = mItems.getSize() - 1;
+            Type pushed = std::move(mItems.data()[hole]);
+            heap::siftUp<Arity>(mItems.data(), hole, std::move(pushed), mCompare, heap::NoTracking());
+        }
+
+        Type pop() {
+            if (isEmpty())
+                throw std::out_of_range("Can not pop, queue is empty");
+            Type last = mItems.popLast();
+            if (isEmpty())
+                return last;
+            Type result = std::move(mItems.data()[0]);
+            heap::siftDown<Arity>(mItems.data(), mItems.getSize(), 0, std::move(last), mCompare, heap::NoTracking());
+            return result;
+        }
+
+        // Pushes a batch. A batch at least as large as the queue is heapified together with it in O(n + k),
+        // a smaller one is sifted up element by element in O(k log n).
+        template<typename InputIt>
+        void pushBatch(InputIt first, InputIt last) {
+            size_type before = getSize();
+            for (; first != last; ++first)
+                mItems.append(*first);
+            size_type added = getSize() - before;
+            if (added >= before) {
+                heap::heapify<Arity>(mItems.data(), getSize(), mCompare, heap::NoTracking());
+                return;
+            }
+            for (size_type hole = before; hole < getSize(); ++hole) {
+                Type pushed = std::move(mItems.data()[hole]);
+                heap::siftUp<Arity>(mItems.data(), hole, std::move(pushed), mCompare, heap::NoTracking());
+            }
+        }
+
+    private:
+        Vector<Type> mItems;
+        Compare mCompare;
+    };
+
+    /*
+     * Priority queue whose elements are addressed by handles returned from push(), so their priority can be
+     * changed in O(log n) with decreaseKey() or update(). Handles of popped and erased elements are reused.
+     */
+    template<typename Type, typename Compare = std::less<Type>, std::size_t Arity = 2>
+    class IndexedPriorityQueue {
+        static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+    public:
+        using size_type = std::size_t;
+        using value_type = Type;
+        using Handle = std::size_t;
+
+        IndexedPriorityQueue() : mSlots(), mPositions(), mFreeHandles(), mLess() { }
+
+        explicit IndexedPriorityQueue(const Compare& pCompare)
+                : mSlots(), mPositions(), mFreeHandles(), mLess{pCompare} { }
+
+        bool isEmpty() const {
+            return mSlots.isEmpty();
+        }
+
+        size_type getSize() const {
+            return mSlots.getSize();
+        }
+
+        bool contains(Handle pHandle) const {
+            return pHandle < mPositions.getSize() && mPositions.data()[pHandle] != NOT_QUEUED;
+        }
+
+        const Type& get(Handle pHandle) const {
+            return mSlots.data()[position(pHandle)].value;
+        }
+
+        const Type& top() const {
+            if (isEmpty())
+                throw std::out_of_range("Can not take top, queue is empty");
+            return mSlots.data()[0].value;
+        }
+
+        Handle topHandle() const {
+            if (isEmpty())
+                throw std::out_of_range("Can not take top, queue is empty");
+            return mSlots.data()[0].handle;
+        }
+
+        Handle push(const Type& item) {
+            return push(Type(item));
+        }
+
+        Handle push(Type&& item) {
+            Handle handle = mPositions.getSize();
+            if (!mFreeHandles.isEmpty())
+                handle = mFreeHandles.popLast();
+            else
+                mPositions.append(NOT_QUEUED);
+            mSlots.append(Slot{std::move(item), handle});
+            size_type hole = getSize() - 1;
+            Slot pushed = std::move(mSlots.data()[hole]);
+            heap::siftUp<Arity>(mSlots.data(), hole, std::move(pushed), mLess, Tracking{*this});
+            return handle;
+        }
+
+        Type pop() {
+            if (isEmpty())
+                throw std::out_of_range("Can not pop, queue is empty");
+            Slot removed = std::move(mSlots.data()[0]);
+            remove_at(0);
+            return std::move(removed.value);
+        }
+
+        // Moves the element towards the top; pItem must not be greater than its current value.
+        void decreaseKey(Handle pHandle, const Type& pItem) {
+            size_type hole = position(pHandle);
+            if (mLess.compare(mSlots.data()[hole].value, pItem))
+                throw std::invalid_argument("Key is not decreased");
+            Slot changed{pItem, pHandle};
+            heap::siftUp<Arity>(mSlots.data(), hole, std::move(changed), mLess, Tracking{*this});
+        }
+
+        // Sets a new value, which may move the element in either direction.
+        void update(Handle pHandle, const Type& pItem) {
+            size_type hole = position(pHandle);
+            Slot changed{pItem, pHandle};
+            if (mLess.compare(pItem, mSlots.data()[hole].value))
+                heap::siftUp<Arity>(mSlots.data(), hole, std::move(changed), mLess, Tracking{*this});
+            else
+                heap::siftDown<Arity>(mSlots.data(), getSize(), hole, std::move(changed), mLess, Tracking{*this});
+        }
+
+        void erase(Handle pHandle) {
+            remove_at(position(pHandle));
+        }
+
+    private:
+        static const size_type NOT_QUEUED = static_cast<size_type>(-1);
+
+        struct Slot {
+            Type value;
+            Handle handle;
+        };
+
+        struct SlotLess {
+            Compare compare;
+
+            bool operator()(const Slot& pLeft, const Slot& pRight) {
+                return compare(pLeft.value, pRight.value);
+            }
+        };
+
+        // Keeps mPositions in step with the heap.
+        struct Tracking {
+            IndexedPriorityQueue& queue;
+
+            void operator()(std::size_t pPosition) const {
+                queue.mPositions.data()[queue.mSlots.data()[pPosition].handle] = pPosition;
+            }
+        };
+
+        Vector<Slot> mSlots;
+        Vector<size_type> mPositions;   // heap position of every handle, NOT_QUEUED when free
+        Vector<Handle> mFreeHandles;
+        SlotLess mLess;
+
+        size_type position(Handle pHandle) const {
+            if (!contains(pHandle))
+                throw std::out_of_range("Handle is not queued");
+            return mPositions.data()[pHandle];
+        }
+
+        // The last slot fills the hole and moves whichever way restores the heap.
+        void remove_at(size_type pHole) {
+            Handle handle = mSlots.data()[pHole].handle;
+            Slot last = mSlots.popLast();
+            mPositions.data()[handle] = NOT_QUEUED;
+            mFreeHandles.append(handle);
+            if (pHole == getSize())
+                return;
+            if (pHole > 0 && mLess(last, mSlots.data()[(pHole - 1) / Arity]))
+                heap::siftUp<Arity>(mSlots.data(), pHole, std::move(last), mLess, Tracking{*this});
+            else
+                heap::siftDown<Arity>(mSlots.data(), getSize(), pHole, std::move(last), mLess, Tracking{*this});
+        }
+    };
+
+    template<typename Type, typename Compare, std::size_t Arity>
+    const std::size_t IndexedPriorityQueue<Type, Compare, Arity>::NOT_QUEUED;
+
+}
+
+#endif // AISDI_LINEAR_PRIORITYQUEUE_H
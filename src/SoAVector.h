@@ -0,0 +1,443 @@
+#ifndef AISDI_LINEAR_SOAVECTOR_H
+#define AISDI_LINEAR_SOAVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace aisdi {
+
+    // Contiguous run of one column, valid until the next insert or erase.
+    template<typename Type>
+    class ColumnSpan {
+    public:
+        ColumnSpan(Type* pData, std::size_t pSize) : mData(pData), mSize(pSize) { }
+
+        Type* data() const {
+            return mData;
+        }
+
+        std::size_t getSize() const {
+            return mSize;
+        }
+
+        Type& operator[](std::size_t pIdx) const {
+            return mData[pIdx];
+        }
+
+        Type* begin() const {
+            return mData;
+        }
+
+        Type* end() const {
+            return mData + mSize;
+        }
+
+    private:
+        Type* mData;
+        std::size_t mSize;
+    };
+
+    /*
+     * Vector of records stored column by column: field I of every element lives in its own array,
+     * so a pass over one field touches only that field's memory. Elements are std::tuple<Fields...>
+     * and iterators dereference to tuples of references, which are proxies and not value_type&.
+     * column<I>() exposes a field as a plain array for scans.
+     */
+    template<typename... Fields>
+    class SoAVector {
+        static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+
+    public:
+        using difference_type = std::ptrdiff_t;
+        using size_type = std::size_t;
+        using value_type = std::tuple<Fields...>;
+        using reference = std::tuple<Fields&...>;
+        using const_reference = std::tuple<const Fields&...>;
+
+        template<std::size_t I>
+        using field_type = typename std::tuple_element<I, value_type>::type;
+
+        class ConstIterator;
+
+        class Iterator;
+
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        // Columns are allocated by the first insert, empty and moved-from vectors own no memory.
+        SoAVector() noexcept : mCapacity(0), mCount(0), mColumns() { }
+
+        SoAVector(std::initializer_list<value_type> l) : SoAVector() {
+            assign(l.begin(), l.end());
+        }
+
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        SoAVector(InputIt first, InputIt last) : SoAVector() {
+            assign(first, last);
+        }
+
+        SoAVector(const SoAVector& other) : SoAVector() {
+            copy_columns(other, Indices());
+        }
+
+        SoAVector(SoAVector&& other) noexcept : SoAVector() {
+            swap(other);
+        }
+
+        ~SoAVector() {
+            delete_columns(mColumns, Indices());
+        }
+
+        SoAVector& operator=(const SoAVector& other) {
+            if (this != &other)
+                copy_columns(other, Indices());
+            return *this;
+        }
+
+        SoAVector& operator=(SoAVector&& other) noexcept {
+            if (this != &other) {
+                SoAVector moved(std::move(other));
+                swap(moved);
+            }
+            return *this;
+        }
+
+        void swap(SoAVector& other) noexcept {
+            std::swap(mCapacity, other.mCapacity);
+            std::swap(mCount, other.mCount);
+            std::swap(mColumns, other.mColumns);
+        }
+
+        // Replaces the contents with [first, last) of tuples, which must not point into this vector.
+        template<typename InputIt>
+        void assign(InputIt first, InputIt last) {
+            mCount = 0;
+            reserve_range(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+            for (; first != last; ++first)
+                insert_at(*first, mCount);
+        }
+
+        // Grows every column to hold at least pCapacity records.
+        void reserve(size_type pCapacity) {
+            if (pCapacity > mCapacity)
+                realocate(pCapacity, Indices());
+        }
+
+        bool isEmpty() const {
+            return mCount == 0;
+        }
+
+        size_type getSize() const {
+            return mCount;
+        }
+
+        void append(const value_type& item) {
+            insert_at(item, mCount);
+        }
+
+        void append(value_type&& item) {
+            insert_at(std::move(item), mCount);
+        }
+
+        void prepend(const value_type& item) {
+            insert_at(item, 0);
+        }
+
+        void prepend(value_type&& item) {
+            insert_at(std::move(item), 0);
+        }
+
+        void insert(const const_iterator& insertPosition, const value_type& item) {
+            insert_at(item, insertPosition.mIndex);
+        }
+
+        void insert(const const_iterator& insertPosition, value_type&& item) {
+            insert_at(std::move(item), insertPosition.mIndex);
+        }
+
+        value_type popFirst() {
+            if (mCount == 0) throw std::out_of_range("Can not popFirst, vector is empty");
+            value_type item = take_at(0, Indices());
+            erase_at(0, 1);
+            return item;
+        }
+
+        value_type popLast() {
+            if (mCount == 0) throw std::out_of_range("Can not popLast, vector is empty");
+            value_type item = take_at(mCount - 1, Indices());
+            erase_at(mCount - 1, 1);
+            return item;
+        }
+
+        void erase(const const_iterator& position) {
+            if (position.mIndex >= mCount)
+                throw std::out_of_range("Erasing out of range");
+            erase_at(position.mIndex, 1);
+        }
+
+        void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded) {
+            if (lastExcluded.mIndex > mCount || firstIncluded.mIndex > lastExcluded.mIndex)
+                throw std::out_of_range("Erasing end");
+            if (firstIncluded.mIndex == lastExcluded.mIndex)
+                return;
+            erase_at(firstIncluded.mIndex, lastExcluded.mIndex - firstIncluded.mIndex);
+        }
+
+        template<std::size_t I>
+        ColumnSpan<field_type<I>> column() {
+            return ColumnSpan<field_type<I>>(std::get<I>(mColumns), mCount);
+        }
+
+        template<std::size_t I>
+        ColumnSpan<const field_type<I>> column() const {
+            return ColumnSpan<const field_type<I>>(std::get<I>(mColumns), mCount);
+        }
+
+        iterator begin() {
+            return Iterator(*this, 0);
+        }
+
+        iterator end() {
+            return Iterator(*this, mCount);
+        }
+
+        const_iterator cbegin() const {
+            return ConstIterator(*this, 0);
+        }
+
+        const_iterator cend() const {
+            return ConstIterator(*this, mCount);
+        }
+
+        const_iterator begin() const {
+            return cbegin();
+        }
+
+        const_iterator end() const {
+            return cend();
+        }
+
+    private:
+        using Indices = std::index_sequence_for<Fields...>;
+        using Columns = std::tuple<Fields*...>;
+        // Evaluates a pack expansion in order, once per column.
+        using Expand = int[];
+
+        static const std::size_t INIT_CAPACITY = 16;
+        std::size_t mCapacity;
+        std::size_t mCount;
+        Columns mColumns;
+
+        friend class ConstIterator;
+
+        template<std::size_t... I>
+        static void delete_columns(Columns& pColumns, std::index_sequence<I...>) {
+            (void) Expand{0, (delete[] std::get<I>(pColumns), 0)...};
+        }
+
+        template<std::size_t... I>
+        reference at(std::size_t pIdx, std::index_sequence<I...>) const {
+            return reference(std::get<I>(mColumns)[pIdx]...);
+        }
+
+        template<std::size_t... I>
+        value_type take_at(std::size_t pIdx, std::index_sequence<I...>) {
+            return value_type(std::move(std::get<I>(mColumns)[pIdx])...);
+        }
+
+        void realocate() {
+            std::size_t capacity = mCapacity * 2;
+            if (capacity < INIT_CAPACITY)
+                capacity = INIT_CAPACITY;
+            realocate(capacity, Indices());
+        }
+
+        template<std::size_t... I>
+        void realocate(std::size_t pSize, std::index_sequence<I...>) {
+            Columns columns(new Fields[pSize]...);
+            (void) Expand{0, (std::move(std::get<I>(mColumns), std::get<I>(mColumns) + mCount,
+                                        std::get<I>(columns)), 0)...};
+            delete_columns(mColumns, Indices());
+            mColumns = columns;
+            mCapacity = pSize;
+        }
+
+        template<std::size_t... I>
+        void copy_columns(const SoAVector& pOther, std::index_sequence<I...>) {
+            if (pOther.mCount > mCapacity) {
+                mCount = 0;
+                realocate(std::max(pOther.mCount, INIT_CAPACITY), Indices());
+            }
+            (void) Expand{0, (std::copy(std::get<I>(pOther.mColumns), std::get<I>(pOther.mColumns) + pOther.mCount,
+                                        std::get<I>(mColumns)), 0)...};
+            mCount = pOther.mCount;
+        }
+
+        template<typename ForwardIt>
+        void reserve_range(ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+            std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+            if (count > mCapacity)
+                realocate(count < INIT_CAPACITY ? std::size_t(INIT_CAPACITY) : count, Indices());
+        }
+
+        template<typename InputIt>
+        void reserve_range(InputIt, InputIt, std::input_iterator_tag) { }
+
+        template<typename Tuple>
+        void insert_at(Tuple&& pValue, std::size_t pPosition) {
+            if (mCount == mCapacity)
+                realocate();
+            insert_fields(std::forward<Tuple>(pValue), pPosition, Indices());
+            ++mCount;
+        }
+
+        template<typename Tuple, std::size_t... I>
+        void insert_fields(Tuple&& pValue, std::size_t pPosition, std::index_sequence<I...>) {
+            (void) Expand{0, (std::move_backward(std::get<I>(mColumns) + pPosition, std::get<I>(mColumns) + mCount,
+                                                 std::get<I>(mColumns) + mCount + 1), 0)...};
+            (void) Expand{0, (std::get<I>(mColumns)[pPosition] = std::get<I>(std::forward<Tuple>(pValue)), 0)...};
+        }
+
+        void erase_at(std::size_t pFirst, std::size_t pCount) {
+            erase_fields(pFirst, pCount, Indices());
+            mCount -= pCount;
+        }
+
+        template<std::size_t... I>
+        void erase_fields(std::size_t pFirst, std::size_t pCount, std::index_sequence<I...>) {
+            (void) Expand{0, (std::move(std::get<I>(mColumns) + pFirst + pCount, std::get<I>(mColumns) + mCount,
+                                        std::get<I>(mColumns) + pFirst), 0)...};
+        }
+    };
+
+    template<typename... Fields>
+    const std::size_t SoAVector<Fields...>::INIT_CAPACITY;
+
+    template<typename... Fields>
+    class SoAVector<Fields...>::ConstIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename SoAVector::value_type;
+        using difference_type = typename SoAVector::difference_type;
+        using pointer = void;
+        using reference = typename SoAVector::const_reference;
+
+        friend class SoAVector<Fields...>;
+
+        explicit ConstIterator(const SoAVector& pVector, std::size_t pIdx) : mVector(pVector), mIndex(pIdx) { }
+
+        reference operator*() const {
+            return mutableReference();
+        }
+
+        ConstIterator& operator++() {
+            if (mIndex == mVector.mCount)
+                throw std::out_of_range("Iterator out of range");
+            ++mIndex;
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator it(*this);
+            operator++();
+            return it;
+        }
+
+        ConstIterator& operator--() {
+            if (mIndex == 0)
+                throw std::out_of_range("Iterator out of range");
+            --mIndex;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            ConstIterator it(*this);
+            operator--();
+            return it;
+        }
+
+        ConstIterator operator+(difference_type d) const {
+            std::size_t new_idx = mIndex + d;
+            if (new_idx >= mVector.mCount)
+                return ConstIterator(mVector, mVector.mCount);
+            return ConstIterator(mVector, new_idx);
+        }
+
+        ConstIterator operator-(difference_type d) const {
+            if (mIndex < (std::size_t) d)
+                throw std::out_of_range("Iterator out of range");
+            return ConstIterator(mVector, mIndex - d);
+        }
+
+        bool operator==(const ConstIterator& other) const {
+            return (mIndex == other.mIndex) && (&mVector == &other.mVector);
+        }
+
+        bool operator!=(const ConstIterator& other) const {
+            return !operator==(other);
+        }
+
+    protected:
+        const SoAVector& mVector;
+        std::size_t mIndex;
+
+        // Columns hold non-const pointers, so both iterators build their proxy here.
+        typename SoAVector::reference mutableReference() const {
+            if (mIndex == mVector.mCount)
+                throw std::out_of_range("Dereferencing end iterator");
+            return mVector.at(mIndex, Indices());
+        }
+    };
+
+    template<typename... Fields>
+    class SoAVector<Fields...>::Iterator : public SoAVector<Fields...>::ConstIterator {
+    public:
+        using reference = typename SoAVector::reference;
+
+        explicit Iterator(const SoAVector& pVector, std::size_t pIdx) : ConstIterator(pVector, pIdx) { }
+
+        Iterator(const ConstIterator& other) : ConstIterator(other) { }
+
+        Iterator& operator++() {
+            ConstIterator::operator++();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto result = *this;
+            ConstIterator::operator++();
+            return result;
+        }
+
+        Iterator& operator--() {
+            ConstIterator::operator--();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto result = *this;
+            ConstIterator::operator--();
+            return result;
+        }
+
+        Iterator operator+(difference_type d) const {
+            return ConstIterator::operator+(d);
+        }
+
+        Iterator operator-(difference_type d) const {
+            return ConstIterator::operator-(d);
+        }
+
+        reference operator*() const {
+            return ConstIterator::mutableReference();
+        }
+    };
+
+}
+
+#endif // AISDI_LINEAR_SOAVECTOR_H
@@ -0,0 +1,307 @@
+#ifndef AISDI_LINEAR_SORT_H
+#define AISDI_LINEAR_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Vector.h"
+
+namespace aisdi {
+
+    struct SortOptions {
+        // Keeps equivalent elements in their original order.
+        bool stable = false;
+        // Worker threads including the caller, 0 uses std::thread::hardware_concurrency().
+        std::size_t threads = 0;
+    };
+
+    namespace sorting {
+
+        // Smallest slice worth a thread of its own; smaller inputs are sorted by fewer threads.
+        const std::size_t MIN_ELEMENTS_PER_THREAD = 1 << 15;
+        // Below this size the histograms cost more than comparison sorting.
+        const std::size_t MIN_RADIX_ELEMENTS = 1024;
+        const std::size_t RADIX_BITS = 8;
+        const std::size_t RADIX_BUCKETS = 1 << RADIX_BITS;
+
+        inline std::size_t threadCount(std::size_t pRequested, std::size_t pCount) {
+            std::size_t threads = pRequested;
+            if (threads == 0)
+                threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+            return std::max<std::size_t>(1, std::min(threads, pCount / MIN_ELEMENTS_PER_THREAD));
+        }
+
+        /*
+         * Calls pTask(0) .. pTask(pThreads - 1), all but the first on threads of their own, and waits
+         * for all of them. The first exception thrown by a task is rethrown in the caller.
+         */
+        template<typename Task>
+        void parallelFor(std::size_t pThreads, Task pTask) {
+            if (pThreads == 1) {
+                pTask(0);
+                return;
+            }
+            std::vector<std::exception_ptr> errors(pThreads);
+            std::vector<std::thread> workers;
+            workers.reserve(pThreads - 1);
+            auto guarded = [&pTask, &errors](std::size_t pIdx) {
+                try {
+                    pTask(pIdx);
+                }
+                catch (...) {
+                    errors[pIdx] = std::current_exception();
+                }
+            };
+            for (std::size_t idx = 1; idx < pThreads; ++idx)
+                workers.emplace_back(guarded, idx);
+            guarded(0);
+            for (std::thread& worker : workers)
+                worker.join();
+            for (std::exception_ptr& error : errors)
+                if (error)
+                    std::rethrow_exception(error);
+        }
+
+        // Bounds of slice pIdx out of pSlices nearly equal slices of pCount elements.
+        inline std::size_t sliceBegin(std::size_t pCount, std::size_t pSlices, std::size_t pIdx) {
+            return pCount / pSlices * pIdx + std::min(pIdx, pCount % pSlices);
+        }
+
+        template<typename Type>
+        void parallelMove(Type* pFrom, Type* pTo, std::size_t pCount, std::size_t pThreads) {
+            parallelFor(pThreads, [=](std::size_t pIdx) {
+                std::size_t first = sliceBegin(pCount, pThreads, pIdx);
+                std::size_t last = sliceBegin(pCount, pThreads, pIdx + 1);
+                std::move(pFrom + first, pFrom + last, pTo + first);
+            });
+        }
+
+        /*
+         * Maps a key to unsigned bits whose ascending order is the key's ascending order:
+         * signed integers get their sign bit flipped, negative floating point numbers all bits
+         * and positive ones the sign bit. -0.0 is ordered before 0.0.
+         */
+        template<typename Type, typename = void>
+        struct RadixKey {
+            static const bool SORTABLE = false;
+        };
+
+        template<typename Type>
+        struct RadixKey<Type, typename std::enable_if<std::is_integral<Type>::value
+                                                      && !std::is_same<Type, bool>::value>::type> {
+            static const bool SORTABLE = true;
+            using Bits = typename std::make_unsigned<Type>::type;
+
+            static Bits bits(Type pKey) {
+                Bits flip = std::is_signed<Type>::value ? Bits(Bits(1) << (sizeof(Bits) * 8 - 1)) : Bits(0);
+                return static_cast<Bits>(static_cast<Bits>(pKey) ^ flip);
+            }
+        };
+
+        template<typename Type>
+        struct RadixKey<Type, typename std::enable_if<std::is_floating_point<Type>::value
+                                                      && (sizeof(Type) == 4 || sizeof(Type) == 8)>::type> {
+            static const bool SORTABLE = true;
+            using Bits = typename std::conditional<sizeof(Type) == 4, std::uint32_t, std::uint64_t>::type;
+
+            static Bits bits(Type pKey) {
+                Bits bits;
+                std::memcpy(&bits, &pKey, sizeof(bits));
+                Bits sign = Bits(1) << (sizeof(Bits) * 8 - 1);
+                return (bits & sign) ? Bits(~bits) : Bits(bits | sign);
+            }
+        };
+
+        template<typename Type>
+        using RadixSortable = std::integral_constant<bool, RadixKey<Type>::SORTABLE>;
+
+        /*
+         * LSD radix sort by RADIX_BITS-bit digits, lowest first. Each thread counts the digits of its
+         * slice, then scatters the slice to offsets reserved for it, so the sort is stable.
+         * Passes where every key has the same digit are skipped.
+         */
+        template<typename Type>
+        void radixSort(Type* pData, Type* pBuffer, std::size_t pCount, std::size_t pThreads) {
+            using Key = RadixKey<Type>;
+            using Counts = std::vector<std::size_t>;
+            std::vector<Counts> counts(pThreads, Counts(RADIX_BUCKETS));
+            Type* from = pData;
+            Type* to = pBuffer;
+            for (std::size_t shift = 0; shift < sizeof(typename Key::Bits) * 8; shift += RADIX_BITS) {
+                auto digit = [shift](const Type& pKey) {
+                    return static_cast<std::size_t>(Key::bits(pKey) >> shift) & (RADIX_BUCKETS - 1);
+                };
+                parallelFor(pThreads, [&](std::size_t pIdx) {
+                    Counts& slice = counts[pIdx];
+                    std::fill(slice.begin(), slice.end(), 0);
+                    std::size_t last = sliceBegin(pCount, pThreads, pIdx + 1);
+                    for (std::size_t idx = sliceBegin(pCount, pThreads, pIdx); idx < last; ++idx)
+                        ++slice[digit(from[idx])];
+                });
+
+                // Turns counts into the first output index of every (digit, slice) pair.
+                std::size_t offset = 0;
+                bool skip = false;
+                for (std::size_t bucket = 0; bucket < RADIX_BUCKETS; ++bucket) {
+                    std::size_t start = offset;
+                    for (Counts& slice : counts) {
+                        std::size_t count = slice[bucket];
+                        slice[bucket] = offset;
+                        offset += count;
+                    }
+                    skip = skip || offset - start == pCount;
+                }
+                if (skip)
+                    continue;
+
+                parallelFor(pThreads, [&](std::size_t pIdx) {
+                    Counts& slice = counts[pIdx];
+                    std::size_t last = sliceBegin(pCount, pThreads, pIdx + 1);
+                    for (std::size_t idx = sliceBegin(pCount, pThreads, pIdx); idx < last; ++idx)
+                        to[slice[digit(from[idx])]++] = std::move(from[idx]);
+                });
+                std::swap(from, to);
+            }
+            if (from != pData)
+                parallelMove(from, pData, pCount, pThreads);
+        }
+
+        // Sorted runs of one merge: [first, middle) and [middle, last) merge into [first, last).
+        struct MergeRuns {
+            std::size_t first;
+            std::size_t middle;
+            std::size_t last;
+        };
+
+        /*
+         * Where part pPart of pParts cuts the right run: the left run is cut into equal pieces and
+         * the right one at the lower bound of the left cut, so equivalent elements of the left run
+         * stay first and the merge is stable.
+         */
+        template<typename Type, typename Compare>
+        std::size_t rightCut(const Type* pData, const MergeRuns& pRuns, std::size_t pPart, std::size_t pParts,
+                             Compare& pCompare) {
+            std::size_t leftCut = pRuns.first + sliceBegin(pRuns.middle - pRuns.first, pParts, pPart);
+            if (pPart == 0)
+                return pRuns.middle;
+            if (leftCut == pRuns.middle)
+                return pRuns.last;
+            return static_cast<std::size_t>(std::lower_bound(pData + pRuns.middle, pData + pRuns.last,
+                                                             pData[leftCut], pCompare) - pData);
+        }
+
+        /*
+         * Every thread sorts one slice, then sorted runs are merged pairwise level by level, all
+         * threads sharing the merges of a level. The cuts of a level are searched before any element
+         * moves, since parts read elements of their neighbours.
+         */
+        template<typename Type, typename Compare>
+        void mergeSort(Type* pData, Type* pBuffer, std::size_t pCount, Compare& pCompare, bool pStable,
+                       std::size_t pThreads) {
+            parallelFor(pThreads, [&](std::size_t pIdx) {
+                Type* first = pData + sliceBegin(pCount, pThreads, pIdx);
+                Type* last = pData + sliceBegin(pCount, pThreads, pIdx + 1);
+                if (pStable)
+                    std::stable_sort(first, last, pCompare);
+                else
+                    std::sort(first, last, pCompare);
+            });
+
+            Type* from = pData;
+            Type* to = pBuffer;
+            std::vector<std::size_t> cuts(pThreads + 1);
+            for (std::size_t width = 1; width < pThreads; width *= 2) {
+                // Pair k merges the slices [2 * k * width, (2 * k + 2) * width), clipped to pThreads.
+                std::size_t pairs = (pThreads + 2 * width - 1) / (2 * width);
+                std::size_t parts = std::max<std::size_t>(1, pThreads / pairs);
+                auto runs = [&](std::size_t pPair) {
+                    std::size_t slice = pPair * 2 * width;
+                    return MergeRuns{sliceBegin(pCount, pThreads, std::min(pThreads, slice)),
+                                     sliceBegin(pCount, pThreads, std::min(pThreads, slice + width)),
+                                     sliceBegin(pCount, pThreads, std::min(pThreads, slice + 2 * width))};
+                };
+                parallelFor(pairs * parts, [&](std::size_t pIdx) {
+                    cuts[pIdx] = rightCut(from, runs(pIdx / parts), pIdx % parts, parts, pCompare);
+                });
+                parallelFor(pairs * parts, [&](std::size_t pIdx) {
+                    MergeRuns pair = runs(pIdx / parts);
+                    std::size_t part = pIdx % parts;
+                    std::size_t leftFirst = pair.first + sliceBegin(pair.middle - pair.first, parts, part);
+                    std::size_t leftLast = pair.first + sliceBegin(pair.middle - pair.first, parts, part + 1);
+                    std::size_t rightFirst = cuts[pIdx];
+                    std::size_t rightLast = part + 1 == parts ? pair.last : cuts[pIdx + 1];
+                    std::merge(std::make_move_iterator(from + leftFirst), std::make_move_iterator(from + leftLast),
+                               std::make_move_iterator(from + rightFirst), std::make_move_iterator(from + rightLast),
+                               to + leftFirst + (rightFirst - pair.middle), pCompare);
+                });
+                std::swap(from, to);
+            }
+            if (from != pData)
+                parallelMove(from, pData, pCount, pThreads);
+        }
+
+        template<typename Type, typename Compare>
+        void sortRange(Type* pData, std::size_t pCount, Compare& pCompare, const SortOptions& pOptions) {
+            std::size_t threads = threadCount(pOptions.threads, pCount);
+            if (threads == 1) {
+                if (pOptions.stable)
+                    std::stable_sort(pData, pData + pCount, pCompare);
+                else
+                    std::sort(pData, pData + pCount, pCompare);
+                return;
+            }
+            std::unique_ptr<Type[]> buffer(new Type[pCount]);
+            mergeSort(pData, buffer.get(), pCount, pCompare, pOptions.stable, threads);
+        }
+
+        template<typename Type>
+        void sortRange(Type* pData, std::size_t pCount, const SortOptions& pOptions, std::true_type) {
+            if (pCount < MIN_RADIX_ELEMENTS) {
+                std::less<Type> less;
+                sortRange(pData, pCount, less, pOptions);
+                return;
+            }
+            std::unique_ptr<Type[]> buffer(new Type[pCount]);
+            radixSort(pData, buffer.get(), pCount, threadCount(pOptions.threads, pCount));
+        }
+
+        template<typename Type>
+        void sortRange(Type* pData, std::size_t pCount, const SortOptions& pOptions, std::false_type) {
+            std::less<Type> less;
+            sortRange(pData, pCount, less, pOptions);
+        }
+
+    }
+
+    /*
+     * Sorts in ascending order of operator<. Integers and floating point numbers are radix sorted,
+     * which is always stable, other types go through sort(pVector, std::less<Type>(), pOptions).
+     * Both use one extra buffer of getSize() elements.
+     */
+    template<typename Type>
+    void sort(Vector<Type>& pVector, const SortOptions& pOptions = SortOptions()) {
+        sorting::sortRange(pVector.data(), pVector.getSize(), pOptions, sorting::RadixSortable<Type>());
+    }
+
+    /*
+     * Sorts by pCompare: every thread sorts a slice with std::sort, or std::stable_sort when
+     * pOptions.stable is set, and the slices are merged in parallel. pCompare is called
+     * concurrently from several threads and must not modify shared state.
+     */
+    template<typename Type, typename Compare>
+    void sort(Vector<Type>& pVector, Compare pCompare, const SortOptions& pOptions = SortOptions()) {
+        sorting::sortRange(pVector.data(), pVector.getSize(), pCompare, pOptions);
+    }
+
+}
+
+#endif // AISDI_LINEAR_SORT_H
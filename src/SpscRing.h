@@ -0,0 +1,160 @@
+#ifndef AISDI_LINEAR_SPSCRING_H
+#define AISDI_LINEAR_SPSCRING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace aisdi {
+
+    /*
+     * Wait-free ring buffer between exactly one producer thread (tryPush, pushN) and one consumer
+     * thread (tryPop, popN). Every call finishes in a bounded number of steps; a full or empty ring
+     * makes it return false or 0 instead of waiting.
+     *
+     * head and tail grow without wrapping and are masked with Capacity - 1. Each side owns one index,
+     * publishes it with a release store and reads the other one with an acquire load, only when its
+     * cached copy says the ring is full (producer) or empty (consumer). Producer and consumer fields
+     * are a cache line apart, so the two threads do not invalidate each other's lines on every call.
+     */
+    template<typename Type, std::size_t Capacity>
+    class SpscRing {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Ring capacity must be a power of two");
+
+    public:
+        using size_type = std::size_t;
+        using value_type = Type;
+
+        static const size_type CACHE_LINE = 64;
+
+        SpscRing() : mSlots(new Type[Capacity]), mHead(0), mCachedTail(0), mTail(0), mCachedHead(0) { }
+
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        ~SpscRing() {
+            delete[] mSlots;
+        }
+
+        static constexpr size_type getCapacity() {
+            return Capacity;
+        }
+
+        // Exact only when neither side is running.
+        size_type getSize() const {
+            return mTail.load(std::memory_order_acquire) - mHead.load(std::memory_order_acquire);
+        }
+
+        bool isEmpty() const {
+            return getSize() == 0;
+        }
+
+        // Producer only. Returns false, leaving pItem untouched, when the ring is full.
+        bool tryPush(const Type& pItem) {
+            return push_item(pItem);
+        }
+
+        bool tryPush(Type&& pItem) {
+            return push_item(std::move(pItem));
+        }
+
+        // Consumer only. Returns false when the ring is empty.
+        bool tryPop(Type& pItem) {
+            size_type head = mHead.load(std::memory_order_relaxed);
+            if (head == mCachedTail) {
+                mCachedTail = mTail.load(std::memory_order_acquire);
+                if (head == mCachedTail)
+                    return false;
+            }
+            pItem = std::move(mSlots[head & MASK]);
+            mHead.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /*
+         * Producer only. Copies up to pCount items from pFirst into the free slots, as at most two contiguous
+         * spans, and publishes them with one store. Returns how many were pushed; pass a move_iterator
+         * to move them instead.
+         */
+        template<typename InputIt>
+        size_type pushN(InputIt pFirst, size_type pCount) {
+            size_type tail = mTail.load(std::memory_order_relaxed);
+            if (Capacity - (tail - mCachedHead) < pCount)
+                mCachedHead = mHead.load(std::memory_order_acquire);
+            size_type count = std::min(pCount, Capacity - (tail - mCachedHead));
+            if (count == 0)
+                return 0;
+            size_type start = tail & MASK;
+            size_type first = std::min(count, Capacity - start);
+            pFirst = copy_span(pFirst, first, mSlots + start);
+            copy_span(pFirst, count - first, mSlots);
+            mTail.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        // Consumer only. Moves up to pMaxCount items to pOut and returns how many were popped.
+        template<typename OutputIt>
+        size_type popN(OutputIt pOut, size_type pMaxCount) {
+            size_type head = mHead.load(std::memory_order_relaxed);
+            if (mCachedTail - head < pMaxCount)
+                mCachedTail = mTail.load(std::memory_order_acquire);
+            size_type count = std::min(pMaxCount, mCachedTail - head);
+            if (count == 0)
+                return 0;
+            size_type start = head & MASK;
+            size_type first = std::min(count, Capacity - start);
+            pOut = std::move(mSlots + start, mSlots + start + first, pOut);
+            std::move(mSlots, mSlots + (count - first), pOut);
+            mHead.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+    private:
+        static const size_type MASK = Capacity - 1;
+
+        // Padding in front of each group keeps them on separate lines wherever the ring is allocated.
+        char mPadding0[CACHE_LINE];
+        Type* const mSlots;
+
+        char mPadding1[CACHE_LINE];
+        std::atomic<size_type> mHead;   // next slot to pop, written by the consumer
+        size_type mCachedTail;          // consumer's last seen tail
+
+        char mPadding2[CACHE_LINE];
+        std::atomic<size_type> mTail;   // next slot to fill, written by the producer
+        size_type mCachedHead;          // producer's last seen head
+
+        char mPadding3[CACHE_LINE];
+
+        template<typename Item>
+        bool push_item(Item&& pItem) {
+            size_type tail = mTail.load(std::memory_order_relaxed);
+            if (tail - mCachedHead == Capacity) {
+                mCachedHead = mHead.load(std::memory_order_acquire);
+                if (tail - mCachedHead == Capacity)
+                    return false;
+            }
+            mSlots[tail & MASK] = std::forward<Item>(pItem);
+            mTail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        template<typename InputIt>
+        static InputIt copy_span(InputIt pFirst, size_type pCount, Type* pOut) {
+            for (size_type i = 0; i < pCount; ++i, ++pFirst)
+                pOut[i] = *pFirst;
+            return pFirst;
+        }
+    };
+
+    template<typename Type, std::size_t Capacity>
+    const std::size_t SpscRing<Type, Capacity>::CACHE_LINE;
+
+    template<typename Type, std::size_t Capacity>
+    const std::size_t SpscRing<Type, Capacity>::MASK;
+
+}
+
+#endif // AISDI_LINEAR_SPSCRING_H
@@ -0,0 +1,174 @@
+#ifndef AISDI_LINEAR_TRACEREPLAY_H
+#define AISDI_LINEAR_TRACEREPLAY_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Benchmark.h"
+#include "BenchmarkTypes.h"
+#include "OperationTrace.h"
+
+namespace aisdi {
+namespace bench {
+
+    // Builds the value inserted by the pIdx-th inserting entry of a trace.
+    template<typename Type>
+    struct TraceValue {
+        static Type make(const TraceEntry&, std::size_t pIdx) {
+            return Element<Type>::make(pIdx);
+        }
+    };
+
+    // Strings reproduce the recorded payload size.
+    template<>
+    struct TraceValue<std::string> {
+        static std::string make(const TraceEntry& pEntry, std::size_t pIdx) {
+            return std::string(pEntry.payload, static_cast<char>('a' + pIdx % 26));
+        }
+    };
+
+    inline bool isInserting(const TraceEntry& pEntry) {
+        return pEntry.operation == TraceOperation::Append || pEntry.operation == TraceOperation::Prepend
+               || pEntry.operation == TraceOperation::Insert;
+    }
+
+    /*
+     * Collection with the values a trace inserts, built ahead so that replaying only moves them in.
+     * The trace must outlive the fixture.
+     */
+    template<typename Collection>
+    struct ReplayFixture {
+        using Value = typename Collection::value_type;
+
+        explicit ReplayFixture(const std::vector<TraceEntry>& pTrace) : trace(&pTrace) {
+            for (const TraceEntry& entry : pTrace)
+                if (isInserting(entry))
+                    values.push_back(TraceValue<Value>::make(entry, values.size()));
+        }
+
+        Collection collection;
+        std::vector<Value> values;
+        const std::vector<TraceEntry>* trace;
+    };
+
+    // Applies a single entry, taking the next prepared value for inserts.
+    template<typename Collection>
+    void apply(ReplayFixture<Collection>& fixture, const TraceEntry& pEntry, std::size_t& pNextValue) {
+        Collection& collection = fixture.collection;
+        switch (pEntry.operation) {
+            case TraceOperation::Append:
+                collection.append(std::move(fixture.values[pNextValue++]));
+                break;
+            case TraceOperation::Prepend:
+                collection.prepend(std::move(fixture.values[pNextValue++]));
+                break;
+            case TraceOperation::Insert:
+                collection.insert(collection.cbegin() + pEntry.position, std::move(fixture.values[pNextValue++]));
+                break;
+            case TraceOperation::PopFirst: {
+                auto item = collection.popFirst();
+                doNotOptimize(item);
+                break;
+            }
+            case TraceOperation::PopLast: {
+                auto item = collection.popLast();
+                doNotOptimize(item);
+                break;
+            }
+            case TraceOperation::Erase:
+                collection.erase(collection.cbegin() + pEntry.position);
+                break;
+            case TraceOperation::EraseRange: {
+                auto first = collection.cbegin() + pEntry.position;
+                collection.erase(first, first + pEntry.length);
+                break;
+            }
+        }
+    }
+
+    // Measure function for Runner::run, pCount is the trace length.
+    template<typename Collection>
+    void replay(ReplayFixture<Collection>& fixture, std::size_t) {
+        std::size_t nextValue = 0;
+        for (const TraceEntry& entry : *fixture.trace)
+            apply(fixture, entry, nextValue);
+        doNotOptimize(fixture.collection);
+    }
+
+    struct OperationLatency {
+        TraceOperation operation;
+        std::size_t count;
+        Statistics stats; // nanoseconds per call
+    };
+
+    struct ReplayReport {
+        std::string container;
+        double totalNs;
+        std::size_t operations;
+        std::vector<OperationLatency> latencies;
+    };
+
+    /*
+     * Replays the trace once, timing every entry separately. Clock reads add a constant
+     * overhead per entry, so use Runner with replay() for throughput and this for the latency shape.
+     */
+    template<typename Collection>
+    ReplayReport replayWithLatencies(const std::string& pContainer, const std::vector<TraceEntry>& pTrace) {
+        using Clock = std::chrono::steady_clock;
+        const TraceOperation operations[] = {
+            TraceOperation::Append, TraceOperation::Prepend, TraceOperation::Insert, TraceOperation::PopFirst,
+            TraceOperation::PopLast, TraceOperation::Erase, TraceOperation::EraseRange
+        };
+        const std::size_t operationCount = sizeof(operations) / sizeof(operations[0]);
+
+        ReplayFixture<Collection> fixture(pTrace);
+        std::vector<std::vector<double>> samples(operationCount);
+        std::size_t nextValue = 0;
+        Clock::time_point begin = Clock::now();
+        for (const TraceEntry& entry : pTrace) {
+            Clock::time_point start = Clock::now();
+            apply(fixture, entry, nextValue);
+            Clock::time_point stop = Clock::now();
+            samples[static_cast<std::size_t>(entry.operation)].push_back(
+                    std::chrono::duration<double, std::nano>(stop - start).count());
+        }
+        Clock::time_point end = Clock::now();
+
+        ReplayReport report;
+        report.container = pContainer;
+        report.totalNs = std::chrono::duration<double, std::nano>(end - begin).count();
+        report.operations = pTrace.size();
+        for (std::size_t idx = 0; idx < operationCount; ++idx)
+            if (!samples[idx].empty())
+                report.latencies.push_back(OperationLatency{operations[idx], samples[idx].size(),
+                                                            summarize(samples[idx])});
+        return report;
+    }
+
+    inline void reportLatencies(std::ostream& out, const std::vector<ReplayReport>& pReports) {
+        out << std::left << std::setw(18) << "container" << std::setw(14) << "operation"
+            << std::right << std::setw(10) << "count" << std::setw(14) << "median[ns]"
+            << std::setw(14) << "p95[ns]" << std::setw(14) << "mean[ns]" << std::setw(14) << "Mops/s" << '\n';
+        for (const ReplayReport& report : pReports) {
+            for (const OperationLatency& latency : report.latencies)
+                out << std::left << std::setw(18) << report.container << std::setw(14) << toString(latency.operation)
+                    << std::right << std::setw(10) << latency.count
+                    << std::fixed << std::setprecision(0)
+                    << std::setw(14) << latency.stats.median << std::setw(14) << latency.stats.p95
+                    << std::setw(14) << latency.stats.mean << std::setw(14) << "" << '\n';
+            out << std::left << std::setw(18) << report.container << std::setw(14) << "total"
+                << std::right << std::setw(10) << report.operations << std::setw(42) << ""
+                << std::fixed << std::setprecision(2)
+                << std::setw(14) << report.operations * 1e3 / std::max(1.0, report.totalNs) << '\n';
+        }
+    }
+
+}
+}
+
+#endif // AISDI_LINEAR_TRACEREPLAY_H
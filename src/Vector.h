@@ -1,14 +1,18 @@
 #ifndef AISDI_LINEAR_VECTOR_H
 #define AISDI_LINEAR_VECTOR_H
 
+#include <algorithm>
 #include <cstddef>
 #include <initializer_list>
+#include <iterator>
 #include <stdexcept>
+#include <utility>
+#include "ContainerStats.h"
 
 namespace aisdi {
 
     template<typename Type>
-    class Vector {
+    class Vector : public ContainerStats {
     public:
         using difference_type = std::ptrdiff_t;
         using size_type = std::size_t;
@@ -25,30 +29,26 @@ namespace aisdi {
         using iterator = Iterator;
         using const_iterator = ConstIterator;
 
-        Vector() : mCapacity(INIT_CAPACITY), mCount(0), mData(new Type[INIT_CAPACITY]) { }
+        // Storage is allocated by the first insert, empty and moved-from vectors own no memory.
+        Vector() noexcept : mCapacity(0), mCount(0), mData(nullptr) { }
 
-        Vector(std::initializer_list<Type> l) : mCapacity(l.size() * 2), mCount(l.size()),
-                                                mData(new Type[mCapacity]) {
-            std::size_t idx = 0;
-            for (auto&& elem : l)
-                mData[idx++] = std::move(elem);
+        Vector(std::initializer_list<Type> l) : Vector() {
+            assign(l.begin(), l.end());
         }
 
-        Vector(const Vector& other) : mCapacity(other.mCapacity), mCount(other.mCount), mData(new Type[mCapacity]) {
-            for (std::size_t idx = 0; idx < other.mCount; ++idx)
-                mData[idx] = other.mData[idx];
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        Vector(InputIt first, InputIt last) : Vector() {
+            assign(first, last);
         }
 
-        Vector(Vector&& other) : Vector() {
-            std::size_t capacity = mCapacity;
-            std::size_t count = mCount;
-            Type* data = mData;
-            mCapacity = std::move(other.mCapacity);
-            mCount = std::move(other.mCount);
-            mData = std::move(other.mData);
-            other.mCapacity = capacity;
-            other.mCount = count;
-            other.mData = data;
+        Vector(const Vector& other) : Vector() {
+            assign(other.mData, other.mData + other.mCount);
+        }
+
+        Vector(Vector&& other) noexcept : mCapacity(other.mCapacity), mCount(other.mCount), mData(other.mData) {
+            other.mCapacity = 0;
+            other.mCount = 0;
+            other.mData = nullptr;
         }
 
         ~Vector() {
@@ -56,25 +56,40 @@ namespace aisdi {
         }
 
         Vector& operator=(const Vector& other) {
-            if (mCapacity <= other.mCapacity)
-                realocate(other.mCapacity);
-            for (std::size_t idx = 0; idx < other.mCapacity; ++idx)
-                mData[idx] = other.mData[idx];
-            mCount = other.mCount;
+            if (this != &other)
+                assign(other.mData, other.mData + other.mCount);
             return *this;
         }
 
-        Vector& operator=(Vector&& other) {
-            Type* data = mData;
-            mCapacity = std::move(other.mCapacity);
-            mCount = std::move(other.mCount);
-            mData = std::move(other.mData);
-            other.mCapacity = INIT_CAPACITY;
+        Vector& operator=(Vector&& other) noexcept {
+            if (this == &other)
+                return *this;
+            delete[] mData;
+            mCapacity = other.mCapacity;
+            mCount = other.mCount;
+            mData = other.mData;
+            other.mCapacity = 0;
             other.mCount = 0;
-            other.mData = data;
+            other.mData = nullptr;
             return *this;
         }
 
+        /*
+         * Replaces the contents with [first, last), which must not point into this vector.
+         * Forward ranges are copied in one pass, into the current buffer when it is large enough
+         * and otherwise into a single new allocation.
+         */
+        template<typename InputIt>
+        void assign(InputIt first, InputIt last) {
+            assign_range(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+        }
+
+        // Grows the buffer to hold at least pCapacity elements, so that many appends do not realocate.
+        void reserve(size_type pCapacity) {
+            if (pCapacity > mCapacity)
+                realocate(pCapacity);
+        }
+
         bool isEmpty() const {
             return mCount == 0;
         }
@@ -87,14 +102,26 @@ namespace aisdi {
             insert_at(item, mCount);
         }
 
+        void append(Type&& item) {
+            insert_at(std::move(item), mCount);
+        }
+
         void prepend(const Type& item) {
             insert_at(item, 0);
         }
 
+        void prepend(Type&& item) {
+            insert_at(std::move(item), 0);
+        }
+
         void insert(const const_iterator& insertPosition, const Type& item) {
             insert_at(item, insertPosition.mIndex);
         }
 
+        void insert(const const_iterator& insertPosition, Type&& item) {
+            insert_at(std::move(item), insertPosition.mIndex);
+        }
+
         Type popFirst() {
             if (mCount == 0) throw std::out_of_range("Can not popFirst, vector is empty");
             Type item = std::move(mData[0]);
@@ -121,12 +148,25 @@ namespace aisdi {
                 throw std::out_of_range("Erasing end");
 
             std::size_t diff = last - first;
+            if (diff == 0)
+                return;
+            countErase(diff);
+            countShift(mCount - last);
 
             for (; last < mCount; ++first, ++last)
-                mData[first] = mData[last];
+                mData[first] = std::move(mData[last]);
             mCount = mCount - diff;
         }
 
+        // Elements are contiguous, data()[0] to data()[getSize() - 1], until the next insert or erase.
+        pointer data() {
+            return mData;
+        }
+
+        const_pointer data() const {
+            return mData;
+        }
+
         iterator begin() {
             return Iterator(*this, 0);
         }
@@ -152,7 +192,7 @@ namespace aisdi {
         }
 
     private:
-        const int INIT_CAPACITY = 16;
+        static const std::size_t INIT_CAPACITY = 16;
         std::size_t mCapacity;
         std::size_t mCount;
         Type* mData;
@@ -160,7 +200,10 @@ namespace aisdi {
         friend class ConstIterator;
 
         void realocate() {
-            realocate(mCapacity * 2);
+            std::size_t capacity = mCapacity * 2;
+            if (capacity < INIT_CAPACITY)
+                capacity = INIT_CAPACITY;
+            realocate(capacity);
         }
 
         void realocate(std::size_t pSize) {
@@ -168,19 +211,54 @@ namespace aisdi {
                 throw std::exception();
             Type* tmp = new Type[pSize];
             for (std::size_t idx = 0; idx < mCount; ++idx)
-                tmp[idx] = mData[idx];
+                tmp[idx] = std::move(mData[idx]);
+            countRealocation(mCount * sizeof(Type));
             delete[] mData;
             mData = tmp;
             mCapacity = pSize;
         }
 
-        void insert_at(const Type& pValue, std::size_t pPosition) {
+        template<typename ForwardIt>
+        void assign_range(ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+            std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+            if (count > mCapacity) {
+                std::size_t capacity = count;
+                if (capacity < INIT_CAPACITY)
+                    capacity = INIT_CAPACITY;
+                Type* tmp = new Type[capacity];
+                std::copy(first, last, tmp);
+                delete[] mData;
+                mData = tmp;
+                mCapacity = capacity;
+            }
+            else
+                std::copy(first, last, mData);
+            mCount = count;
+            countCopy(count * sizeof(Type));
+        }
+
+        template<typename InputIt>
+        void assign_range(InputIt first, InputIt last, std::input_iterator_tag) {
+            mCount = 0;
+            for (; first != last; ++first)
+                append(*first);
+        }
+
+        template<typename Value>
+        void insert_at(Value&& pValue, std::size_t pPosition) {
             if (mCount == mCapacity)
                 realocate();
+            if (pPosition == mCount)
+                countAppend();
+            else if (pPosition == 0)
+                countPrepend();
+            else
+                countMiddleInsert();
+            countShift(mCount - pPosition);
 
             for (std::size_t idx = mCount; idx > pPosition; --idx)
-                mData[idx] = mData[idx - 1];
-            mData[pPosition] = pValue;
+                mData[idx] = std::move(mData[idx - 1]);
+            mData[pPosition] = std::forward<Value>(pValue);
             ++mCount;
 
         }
@@ -188,8 +266,10 @@ namespace aisdi {
         void erase_at(std::size_t pIdx) {
             if (pIdx >= mCount)
                 throw std::out_of_range("Erasing out of range");
+            countErase(1);
+            countShift(mCount - pIdx - 1);
             for (std::size_t idx = pIdx; idx + 1 < mCount; ++idx)
-                mData[idx] = mData[idx + 1];
+                mData[idx] = std::move(mData[idx + 1]);
             --mCount;
         }
     };
@@ -0,0 +1,175 @@
+#ifndef AISDI_LINEAR_WORKSTEALINGDEQUE_H
+#define AISDI_LINEAR_WORKSTEALINGDEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include "Vector.h"
+
+namespace aisdi {
+
+    /*
+     * Chase-Lev work-stealing deque with the memory orderings of Le, Pop, Cohen and Zappa Nardelli
+     * ("Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+     *
+     * The owner thread pushes and pops at the bottom (LIFO) without locks; any thread may steal from
+     * the top (FIFO). Only the last element is contended, and a single CAS on top decides who gets it.
+     * steal() returns false both for an empty deque and for a lost race; callers simply try again
+     * or go elsewhere.
+     *
+     * Elements live in atomic slots of a circular array, so Type must be trivially copyable (task
+     * pointers, indices, small ranges) and should fit in 8 bytes for the slots to stay lock-free.
+     * When full, push() copies the live elements into an array twice as large. A thief may still be
+     * reading the old array, so it is retired rather than freed and released with the deque;
+     * geometric growth keeps retired arrays below the size of the current one.
+     */
+    template<typename Type>
+    class WorkStealingDeque {
+        static_assert(std::is_trivially_copyable<Type>::value, "Deque elements must be trivially copyable");
+
+    public:
+        using size_type = std::size_t;
+        using value_type = Type;
+
+        static const size_type CACHE_LINE = 64;
+
+        // pCapacity is rounded up to a power of two.
+        explicit WorkStealingDeque(size_type pCapacity = 1024) : mTop(0), mBottom(0), mArray(nullptr), mRetired() {
+            if (pCapacity == 0)
+                throw std::invalid_argument("Deque capacity must be positive");
+            size_type capacity = 1;
+            while (capacity < pCapacity)
+                capacity *= 2;
+            mArray.store(new Array(capacity), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        ~WorkStealingDeque() {
+            delete mArray.load(std::memory_order_relaxed);
+            for (Array* array : mRetired)
+                delete array;
+        }
+
+        // Exact only when no thread is pushing, popping or stealing.
+        size_type getSize() const {
+            std::int64_t bottom = mBottom.load(std::memory_order_relaxed);
+            std::int64_t top = mTop.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+        }
+
+        bool isEmpty() const {
+            return getSize() == 0;
+        }
+
+        // Owner only.
+        size_type getCapacity() const {
+            return mArray.load(std::memory_order_relaxed)->capacity;
+        }
+
+        // Owner only.
+        void push(Type pItem) {
+            std::int64_t bottom = mBottom.load(std::memory_order_relaxed);
+            std::int64_t top = mTop.load(std::memory_order_acquire);
+            Array* array = mArray.load(std::memory_order_relaxed);
+            if (bottom - top > static_cast<std::int64_t>(array->capacity) - 1)
+                array = grow(array, top, bottom);
+            array->put(bottom, pItem);
+            std::atomic_thread_fence(std::memory_order_release);
+            mBottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        // Owner only. Takes the most recently pushed element.
+        bool pop(Type& pItem) {
+            std::int64_t bottom = mBottom.load(std::memory_order_relaxed) - 1;
+            Array* array = mArray.load(std::memory_order_relaxed);
+            mBottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t top = mTop.load(std::memory_order_relaxed);
+            if (top > bottom) {
+                mBottom.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+            pItem = array->get(bottom);
+            if (top == bottom) {
+                // The last element: thieves may race for it.
+                bool won = mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                        std::memory_order_relaxed);
+                mBottom.store(bottom + 1, std::memory_order_relaxed);
+                return won;
+            }
+            return true;
+        }
+
+        // Any thread. Takes the least recently pushed element.
+        bool steal(Type& pItem) {
+            std::int64_t top = mTop.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t bottom = mBottom.load(std::memory_order_acquire);
+            if (top >= bottom)
+                return false;
+            Type item = mArray.load(std::memory_order_acquire)->get(top);
+            if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return false;
+            pItem = item;
+            return true;
+        }
+
+    private:
+        struct Array {
+            size_type capacity;
+            size_type mask;
+            std::atomic<Type>* slots;
+
+            explicit Array(size_type pCapacity)
+                    : capacity(pCapacity), mask(pCapacity - 1), slots(new std::atomic<Type>[pCapacity]) { }
+
+            Array(const Array&) = delete;
+            Array& operator=(const Array&) = delete;
+
+            ~Array() {
+                delete[] slots;
+            }
+
+            Type get(std::int64_t pIndex) const {
+                return slots[static_cast<size_type>(pIndex) & mask].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t pIndex, Type pItem) {
+                slots[static_cast<size_type>(pIndex) & mask].store(pItem, std::memory_order_relaxed);
+            }
+        };
+
+        char mPadding0[CACHE_LINE];
+        std::atomic<std::int64_t> mTop;     // next element to steal, advanced by thieves and the owner's last pop
+        char mPadding1[CACHE_LINE];
+        std::atomic<std::int64_t> mBottom;  // next slot to push, written by the owner only
+        std::atomic<Array*> mArray;
+        Vector<Array*> mRetired;            // replaced arrays thieves may still read, owner only
+        char mPadding2[CACHE_LINE];
+
+        Array* grow(Array* pOld, std::int64_t pTop, std::int64_t pBottom) {
+            Array* array = new Array(pOld->capacity * 2);
+            for (std::int64_t index = pTop; index < pBottom; ++index)
+                array->put(index, pOld->get(index));
+            try {
+                mRetired.append(pOld);
+            }
+            catch (...) {
+                delete array;
+                throw;
+            }
+            mArray.store(array, std::memory_order_release);
+            return array;
+        }
+    };
+
+    template<typename Type>
+    const std::size_t WorkStealingDeque<Type>::CACHE_LINE;
+
+}
+
+#endif // AISDI_LINEAR_WORKSTEALINGDEQUE_H
@@ -1,112 +1,1283 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <cmath>
 #include <cstdlib>
+#include <iomanip>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <random>
-#include "../CODEine/benchmark.h"
+#include <set>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Benchmark.h"
+#include "BenchmarkStore.h"
+#include "BenchmarkTypes.h"
+#include "TraceReplay.h"
+#ifdef AISDI_TRACK_ALLOCATIONS
+#  include "AllocationHooks.h"
+#endif
 #include "Vector.h"
 #include "LinkedList.h"
+#include "ForwardList.h"
+#include "ArrayList.h"
+#include "IndexedSequence.h"
+#include "SoAVector.h"
+#include "BitVector.h"
+#include "CompressedIntVector.h"
+#include "FlatSet.h"
+#include "Sort.h"
+#include "LruCache.h"
+#include "PriorityQueue.h"
+#include "Channel.h"
+#include "SpscRing.h"
+#include "WorkStealingDeque.h"
+#include "GapVector.h"
 #include <iostream>
+#include <fstream>
+#ifdef __linux__
+#  include <pthread.h>
+#endif
 
 namespace {
 
     template<typename T>
     using List = aisdi::LinkedList<T>;
 
+    template<typename T>
+    using ForwardList = aisdi::ForwardList<T>;
+
+    template<typename T>
+    using ArrayList = aisdi::ArrayList<T>;
+
     template<typename T>
     using Vector = aisdi::Vector<T>;
 
+    template<typename T>
+    using IndexedSequence = aisdi::IndexedSequence<T>;
+
+    template<typename T>
+    using GapVector = aisdi::GapVector<T>;
+
+    using RecordColumns = aisdi::SoAVector<std::int64_t, double, std::int32_t, std::int64_t, std::array<char, 16>>;
+
+    using aisdi::bench::doNotOptimize;
+    using aisdi::bench::Element;
+
+    // Values are built during setup, so measured loops only move them into the collection.
+    template<typename Collection>
+    struct Fixture {
+        using Value = typename Collection::value_type;
+
+        Collection collection;
+        std::vector<Value> values;
+        std::vector<int> positions;
+    };
+
+}
+
+template<typename Collection>
+Fixture<Collection> withValues(std::size_t pCount) {
+    using Value = typename Collection::value_type;
+    Fixture<Collection> fixture;
+    fixture.values.reserve(pCount);
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.values.push_back(Element<Value>::make(i));
+    }
+    return fixture;
+}
+
+template<typename Collection>
+Fixture<Collection> withFilledCollection(std::size_t pCount) {
+    using Value = typename Collection::value_type;
+    Fixture<Collection> fixture;
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.collection.append(Element<Value>::make(i));
+    }
+    return fixture;
+}
+
+template<typename Collection>
+Fixture<Collection> withRandomPositions(std::size_t pCount) {
+    Fixture<Collection> fixture = withValues<Collection>(pCount);
+    std::default_random_engine eng(static_cast<unsigned>(pCount));
+    for (std::size_t i = 0; i < pCount; i++) {
+        std::uniform_int_distribution<int> distr(0, static_cast<int>(i));
+        fixture.positions.push_back(distr(eng));
+    }
+    return fixture;
+}
+
+template<typename Collection>
+void append(Fixture<Collection>& fixture, std::size_t pCount) {
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.collection.append(std::move(fixture.values[i]));
+    }
+    doNotOptimize(fixture.collection);
+}
+
+template<typename Collection>
+void prepend(Fixture<Collection>& fixture, std::size_t pCount) {
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.collection.prepend(std::move(fixture.values[i]));
+    }
+    doNotOptimize(fixture.collection);
+}
+
+template<typename Collection>
+void popFirst(Fixture<Collection>& fixture, std::size_t pCount) {
+    for (std::size_t i = 0; i < pCount; i++) {
+        auto item = fixture.collection.popFirst();
+        doNotOptimize(item);
+    }
+}
+
+template<typename Collection>
+void randomInsert(Fixture<Collection>& fixture, std::size_t pCount) {
+    Collection& collection = fixture.collection;
+    for (std::size_t i = 0; i < pCount; i++) {
+        auto it = collection.begin() + fixture.positions[i];
+        collection.insert(it, std::move(fixture.values[i]));
+    }
+    doNotOptimize(collection);
+}
+
+template<typename Collection>
+Fixture<Collection> withSeekTargets(std::size_t pCount) {
+    Fixture<Collection> fixture = withFilledCollection<Collection>(pCount);
+    std::default_random_engine eng(static_cast<unsigned>(pCount));
+    std::uniform_int_distribution<int> distr(0, static_cast<int>(pCount) - 1);
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.positions.push_back(distr(eng));
+    }
+    return fixture;
+}
+
+// Frees node sized blocks in random order first, so the allocator hands them out again scattered
+// over the heap, the way nodes end up after long churn.
+Fixture<List<int>> withScatteredNodes(std::size_t pCount) {
+    std::vector<void*> blocks(pCount);
+    for (void*& block : blocks) {
+        block = ::operator new(sizeof(List<int>::NodeExtended));
+    }
+    std::shuffle(blocks.begin(), blocks.end(), std::default_random_engine(static_cast<unsigned>(pCount)));
+    for (void* block : blocks) {
+        ::operator delete(block);
+    }
+    return withSeekTargets<List<int>>(pCount);
+}
+
+template<typename Collection>
+void forwardScan(Fixture<Collection>& fixture, std::size_t) {
+    const Collection& collection = fixture.collection;
+    long long sum = 0;
+    for (auto it = collection.cbegin(); it != collection.cend(); ++it) {
+        sum += *it;
+    }
+    doNotOptimize(sum);
+}
+
+template<typename Collection>
+void reverseScan(Fixture<Collection>& fixture, std::size_t) {
+    const Collection& collection = fixture.collection;
+    long long sum = 0;
+    auto begin = collection.cbegin();
+    auto it = collection.cend();
+    while (it != begin) {
+        --it;
+        sum += *it;
+    }
+    doNotOptimize(sum);
+}
+
+template<typename Collection>
+void indexAccess(Fixture<Collection>& fixture, std::size_t pCount) {
+    const Collection& collection = fixture.collection;
+    long long sum = 0;
+    for (std::size_t i = 0; i < pCount; i++) {
+        sum += *(collection.cbegin() + i);
+    }
+    doNotOptimize(sum);
+}
+
+template<typename Collection>
+void seek(Fixture<Collection>& fixture, std::size_t pCount) {
+    const Collection& collection = fixture.collection;
+    long long sum = 0;
+    for (std::size_t i = 0; i < pCount; i++) {
+        sum += *(collection.cbegin() + fixture.positions[i]);
+    }
+    doNotOptimize(sum);
+}
+
+Fixture<RecordColumns> withRecordColumns(std::size_t pCount) {
+    Fixture<RecordColumns> fixture;
+    for (std::size_t i = 0; i < pCount; i++) {
+        aisdi::bench::Record record = Element<aisdi::bench::Record>::make(i);
+        fixture.collection.append(RecordColumns::value_type(record.id, record.price, record.quantity,
+                                                            record.timestamp, std::array<char, 16>()));
+    }
+    return fixture;
+}
+
+// Reads one field of every record, dragging whole records through the cache.
+void priceScan(Fixture<Vector<aisdi::bench::Record>>& fixture, std::size_t) {
+    const Vector<aisdi::bench::Record>& collection = fixture.collection;
+    double sum = 0;
+    for (auto it = collection.cbegin(); it != collection.cend(); ++it) {
+        sum += (*it).price;
+    }
+    doNotOptimize(sum);
+}
+
+void priceColumnScan(Fixture<RecordColumns>& fixture, std::size_t) {
+    double sum = 0;
+    for (double price : fixture.collection.column<1>()) {
+        sum += price;
+    }
+    doNotOptimize(sum);
 }
 
 template<typename Collection>
-void append(int pCount) {
-    std::cout << pCount << std::endl;
-    Collection col;
-    for (int i = 0; i < pCount; i++) {
-        col.append(i);
+void countSet(Fixture<Collection>& fixture, std::size_t) {
+    const Collection& collection = fixture.collection;
+    std::size_t count = 0;
+    for (auto it = collection.cbegin(); it != collection.cend(); ++it) {
+        count += *it;
     }
+    doNotOptimize(count);
 }
 
+void countSetWords(Fixture<aisdi::BitVector>& fixture, std::size_t) {
+    std::size_t count = fixture.collection.popcount();
+    doNotOptimize(count);
+}
+
+// Increasing ids with gaps of 1 to 64.
 template<typename Collection>
-void prepend(int pCount) {
-    std::cout << pCount << std::endl;
-    Collection col;
-    for (int i = 0; i < pCount; i++) {
-        col.prepend(i);
+Fixture<Collection> withSortedIds(std::size_t pCount) {
+    Fixture<Collection> fixture;
+    std::default_random_engine eng(static_cast<unsigned>(pCount));
+    std::uniform_int_distribution<std::int64_t> gap(1, 64);
+    std::int64_t id = 1000000;
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.collection.append(id);
+        id += gap(eng);
     }
+    return fixture;
 }
 
 template<typename Collection>
-void popFirst(int pCount) {
-    std::cout << pCount << std::endl;
-    Collection col;
+void sumScan(Fixture<Collection>& fixture, std::size_t) {
+    const Collection& collection = fixture.collection;
+    std::int64_t sum = 0;
+    for (auto it = collection.cbegin(); it != collection.cend(); ++it) {
+        sum += *it;
+    }
+    doNotOptimize(sum);
+}
+
+void sumBlocks(Fixture<aisdi::CompressedIntVector<std::int64_t>>& fixture, std::size_t) {
+    const aisdi::CompressedIntVector<std::int64_t>& collection = fixture.collection;
+    std::int64_t block[aisdi::CompressedIntVector<std::int64_t>::BLOCK_SIZE];
+    std::int64_t sum = 0;
+    for (std::size_t idx = 0; idx < collection.getBlockCount(); idx++) {
+        std::size_t count = collection.decodeBlock(idx, block);
+        for (std::size_t i = 0; i < count; i++) {
+            sum += block[i];
+        }
+    }
+    doNotOptimize(sum);
+}
 
-    for (int i = 0; i < pCount; i++) {
-        col.append(i);
+// Even keys 0, 2, ..., looked up at random positions, half of which miss.
+template<typename Collection>
+Fixture<Collection> withEvenKeys(std::size_t pCount) {
+    Fixture<Collection> fixture;
+    std::vector<int> keys;
+    for (std::size_t i = 0; i < pCount; i++) {
+        keys.push_back(static_cast<int>(2 * i));
     }
-    for (int i = 0; i < pCount; i++) {
-        col.popFirst();
+    fixture.collection.insert(keys.begin(), keys.end());
+    std::default_random_engine eng(static_cast<unsigned>(pCount));
+    std::uniform_int_distribution<int> distr(0, static_cast<int>(2 * pCount));
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.positions.push_back(distr(eng));
     }
+    return fixture;
 }
 
+template<>
+Fixture<aisdi::FlatSet<int>> withEvenKeys(std::size_t pCount) {
+    Fixture<std::set<int>> keys = withEvenKeys<std::set<int>>(pCount);
+    Fixture<aisdi::FlatSet<int>> fixture;
+    fixture.collection.insertBatch(keys.collection.begin(), keys.collection.end());
+    fixture.positions = std::move(keys.positions);
+    return fixture;
+}
+
+bool containsKey(const std::set<int>& pSet, int pKey) {
+    return pSet.count(pKey) != 0;
+}
+
+bool containsKey(const aisdi::FlatSet<int>& pSet, int pKey) {
+    return pSet.contains(pKey);
+}
 
 template<typename Collection>
-void randomInsert(int pCount) {
-    std::cout << pCount << std::endl;
-    Collection collection;
-    std::random_device rand;
-    std::default_random_engine eng(rand());
-    std::uniform_int_distribution<int> distr(0, pCount);
+void lookup(Fixture<Collection>& fixture, std::size_t pCount) {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < pCount; i++) {
+        found += containsKey(fixture.collection, fixture.positions[i]);
+    }
+    doNotOptimize(found);
+}
 
-    for (int i = 0; i < pCount; i++) {
-        int val = distr(eng);
-        auto it = collection.begin() + val;
-        collection.insert(it, i);
+// Odd keys in random order, none of them present yet.
+Fixture<aisdi::FlatSet<int>> withNewKeys(std::size_t pCount) {
+    Fixture<aisdi::FlatSet<int>> fixture = withEvenKeys<aisdi::FlatSet<int>>(pCount);
+    for (int& position : fixture.positions) {
+        position |= 1;
     }
+    fixture.values = fixture.positions;
+    return fixture;
+}
+
+void insertEach(Fixture<aisdi::FlatSet<int>>& fixture, std::size_t pCount) {
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.collection.insert(fixture.values[i]);
+    }
+    doNotOptimize(fixture.collection);
+}
+
+void insertBatch(Fixture<aisdi::FlatSet<int>>& fixture, std::size_t pCount) {
+    fixture.collection.insertBatch(fixture.values.begin(), fixture.values.begin() + pCount);
+    doNotOptimize(fixture.collection);
+}
+
+#ifdef NDEBUG
+// Sort scenarios run only in optimized builds.
+
+// Elements of withFilledCollection in random order.
+template<typename Type>
+Fixture<Vector<Type>> withShuffledValues(std::size_t pCount) {
+    Fixture<Vector<Type>> fixture = withFilledCollection<Vector<Type>>(pCount);
+    Type* data = fixture.collection.data();
+    std::shuffle(data, data + pCount, std::default_random_engine(static_cast<unsigned>(pCount)));
+    return fixture;
+}
+
+Fixture<Vector<double>> withRandomDoubles(std::size_t pCount) {
+    Fixture<Vector<double>> fixture;
+    std::default_random_engine eng(static_cast<unsigned>(pCount));
+    std::uniform_real_distribution<double> distr(-1e9, 1e9);
+    fixture.collection.reserve(pCount);
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.collection.append(distr(eng));
+    }
+    return fixture;
+}
+
+template<typename Type>
+void stdSort(Fixture<Vector<Type>>& fixture, std::size_t pCount) {
+    std::sort(fixture.collection.data(), fixture.collection.data() + pCount);
+    doNotOptimize(fixture.collection);
+}
+
+template<typename Type>
+void parallelSort(Fixture<Vector<Type>>& fixture, std::size_t) {
+    aisdi::sort(fixture.collection);
+    doNotOptimize(fixture.collection);
+}
+
+// Records by price, which repeats every 1000 records, so stability is observable.
+bool byPrice(const aisdi::bench::Record& pLeft, const aisdi::bench::Record& pRight) {
+    return pLeft.price < pRight.price;
+}
+
+void stdStableSortRecords(Fixture<Vector<aisdi::bench::Record>>& fixture, std::size_t pCount) {
+    std::stable_sort(fixture.collection.data(), fixture.collection.data() + pCount, byPrice);
+    doNotOptimize(fixture.collection);
+}
+
+void parallelStableSortRecords(Fixture<Vector<aisdi::bench::Record>>& fixture, std::size_t) {
+    aisdi::SortOptions options;
+    options.stable = true;
+    aisdi::sort(fixture.collection, byPrice, options);
+    doNotOptimize(fixture.collection);
+}
+#endif
+
+// Scheduler hold model: the queue holds pCount deadlines, every operation takes the earliest one
+// and schedules a new deadline after it.
+template<typename Queue>
+Fixture<Queue> withDeadlines(std::size_t pCount) {
+    Fixture<Queue> fixture;
+    std::default_random_engine eng(static_cast<unsigned>(pCount));
+    std::uniform_int_distribution<int> distr(0, 1000);
+    std::vector<int> deadlines;
+    for (std::size_t i = 0; i < pCount; i++) {
+        deadlines.push_back(distr(eng));
+        fixture.values.push_back(distr(eng));
+    }
+    fixture.collection.pushBatch(deadlines.begin(), deadlines.end());
+    return fixture;
+}
+
+template<>
+Fixture<Vector<int>> withDeadlines(std::size_t pCount) {
+    Fixture<aisdi::PriorityQueue<int>> deadlines = withDeadlines<aisdi::PriorityQueue<int>>(pCount);
+    Fixture<Vector<int>> fixture;
+    while (!deadlines.collection.isEmpty()) {
+        fixture.collection.append(deadlines.collection.pop());
+    }
+    fixture.values = std::move(deadlines.values);
+    return fixture;
+}
+
+// The sorted Vector the schedulers used so far: binary search and insert, earliest deadline first.
+void schedule(Vector<int>& pQueue, int pDeadline) {
+    const int* data = pQueue.data();
+    auto position = std::upper_bound(data, data + pQueue.getSize(), pDeadline) - data;
+    pQueue.insert(pQueue.begin() + position, pDeadline);
+}
+
+int takeEarliest(Vector<int>& pQueue) {
+    return pQueue.popFirst();
+}
+
+template<std::size_t Arity>
+void schedule(aisdi::PriorityQueue<int, std::less<int>, Arity>& pQueue, int pDeadline) {
+    pQueue.push(pDeadline);
+}
+
+template<std::size_t Arity>
+int takeEarliest(aisdi::PriorityQueue<int, std::less<int>, Arity>& pQueue) {
+    return pQueue.pop();
+}
+
+template<typename Queue>
+void hold(Fixture<Queue>& fixture, std::size_t pCount) {
+    for (std::size_t i = 0; i < pCount; i++) {
+        schedule(fixture.collection, takeEarliest(fixture.collection) + fixture.values[i]);
+    }
+    doNotOptimize(fixture.collection);
+}
+
+template<typename Queue>
+Fixture<Queue> withRandomKeys(std::size_t pCount) {
+    Fixture<Queue> fixture;
+    std::default_random_engine eng(static_cast<unsigned>(pCount));
+    std::uniform_int_distribution<int> distr;
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.values.push_back(distr(eng));
+    }
+    return fixture;
+}
+
+template<typename Queue>
+void heapify(Fixture<Queue>& fixture, std::size_t) {
+    Queue queue(fixture.values.begin(), fixture.values.end());
+    doNotOptimize(queue);
+}
+
+template<typename Queue>
+void pushEach(Fixture<Queue>& fixture, std::size_t pCount) {
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.collection.push(fixture.values[i]);
+    }
+    doNotOptimize(fixture.collection);
+}
+
+// pCount queued keys, each decreased once in random order.
+template<typename Queue>
+Fixture<Queue> withQueuedHandles(std::size_t pCount) {
+    Fixture<Queue> fixture;
+    std::default_random_engine eng(static_cast<unsigned>(pCount));
+    std::uniform_int_distribution<int> distr(0, 1 << 20);
+    for (std::size_t i = 0; i < pCount; i++) {
+        fixture.positions.push_back(static_cast<int>(fixture.collection.push(distr(eng))));
+        fixture.values.push_back(distr(eng) >> 4);
+    }
+    std::shuffle(fixture.positions.begin(), fixture.positions.end(), eng);
+    return fixture;
+}
+
+template<typename Queue>
+void decreaseKeys(Fixture<Queue>& fixture, std::size_t pCount) {
+    for (std::size_t i = 0; i < pCount; i++) {
+        auto handle = static_cast<typename Queue::Handle>(fixture.positions[i]);
+        fixture.collection.decreaseKey(handle, fixture.collection.get(handle) - fixture.values[i]);
+    }
+    doNotOptimize(fixture.collection);
+}
+
+// Pipeline of PIPELINE_STAGES relay threads between a source and a sink, each stage connected by a queue.
+const std::size_t PIPELINE_STAGES = 3;
+const std::size_t CHANNEL_CAPACITY = 1024;
+const std::size_t CHANNEL_BATCH = 64;
+
+struct Message {
+    std::size_t sequence;
+    std::chrono::steady_clock::time_point sent;
+};
+
+// Mutex guarded LinkedList polled with short sleeps, how pipeline stages were connected so far.
+class PolledQueue {
+public:
+    explicit PolledQueue(std::size_t) : mClosed(false) { }
+
+    void send(const Message& pMessage) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mItems.append(pMessage);
+    }
+
+    bool receive(Message& pMessage) {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (!mItems.isEmpty()) {
+                    pMessage = mItems.popFirst();
+                    return true;
+                }
+                if (mClosed)
+                    return false;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mClosed = true;
+    }
+
+private:
+    std::mutex mMutex;
+    List<Message> mItems;
+    bool mClosed;
+};
+
+template<typename Queue>
+void relay(Queue& pIn, Queue& pOut, std::false_type) {
+    Message message;
+    while (pIn.receive(message)) {
+        pOut.send(message);
+    }
+    pOut.close();
+}
+
+void relay(aisdi::Channel<Message>& pIn, aisdi::Channel<Message>& pOut, std::true_type) {
+    std::vector<Message> batch(CHANNEL_BATCH);
+    while (std::size_t count = pIn.receiveMany(batch.begin(), CHANNEL_BATCH)) {
+        pOut.sendMany(batch.begin(), batch.begin() + count);
+    }
+    pOut.close();
+}
+
+/*
+ * Sends pCount messages through the pipeline and returns the latency of every message in nanoseconds,
+ * from the source handing it over to the sink receiving it.
+ */
+template<typename Queue, bool Batched>
+std::vector<double> runPipeline(std::size_t pCount) {
+    using Clock = std::chrono::steady_clock;
+    std::vector<std::unique_ptr<Queue>> queues;
+    for (std::size_t i = 0; i <= PIPELINE_STAGES; i++) {
+        queues.emplace_back(new Queue(CHANNEL_CAPACITY));
+    }
+    std::vector<std::thread> stages;
+    for (std::size_t i = 0; i < PIPELINE_STAGES; i++) {
+        stages.emplace_back([&queues, i] {
+            relay(*queues[i], *queues[i + 1], std::integral_constant<bool, Batched>());
+        });
+    }
+    std::vector<double> latencies(pCount);
+    std::thread sink([&queues, &latencies] {
+        Queue& last = *queues.back();
+        Message message;
+        while (last.receive(message)) {
+            latencies[message.sequence] = static_cast<double>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - message.sent).count());
+        }
+    });
+
+    Queue& first = *queues.front();
+    for (std::size_t i = 0; i < pCount; i++) {
+        first.send(Message{i, Clock::now()});
+    }
+    first.close();
+    for (std::thread& stage : stages) {
+        stage.join();
+    }
+    sink.join();
+    return latencies;
+}
+
+template<typename Queue, bool Batched>
+void pipeline(std::size_t&, std::size_t pCount) {
+    doNotOptimize(runPipeline<Queue, Batched>(pCount));
+}
+
+std::size_t withMessageCount(std::size_t pCount) {
+    return pCount;
+}
+
+void reportPipelineLatencies(std::ostream& out, std::size_t pCount) {
+    auto report = [&out](const std::string& pName, std::vector<double> pLatencies) {
+        std::sort(pLatencies.begin(), pLatencies.end());
+        auto at = [&pLatencies](double pQuantile) {
+            return pLatencies[static_cast<std::size_t>(pQuantile * (pLatencies.size() - 1))] / 1000.0;
+        };
+        out << "  " << std::left << std::setw(16) << pName << std::right << std::fixed << std::setprecision(1)
+            << std::setw(10) << at(0.5) << std::setw(10) << at(0.99) << std::setw(12) << at(1.0) << std::endl;
+    };
+    out << "Pipeline latency (" << PIPELINE_STAGES << " stages, " << pCount << " messages) [us]" << std::endl
+        << "  " << std::left << std::setw(16) << "queue" << std::right << std::setw(10) << "p50"
+        << std::setw(10) << "p99" << std::setw(12) << "max" << std::endl;
+    report("PolledList", runPipeline<PolledQueue, false>(pCount));
+    report("Channel", runPipeline<aisdi::Channel<Message>, false>(pCount));
+    report("Channel(batch)", runPipeline<aisdi::Channel<Message>, true>(pCount));
+}
+
+// Thread to thread handoff of sequence numbers between a producer pinned to CPU 0 and a consumer on CPU 1.
+const std::size_t RING_CAPACITY = 1024;
+const std::size_t RING_BATCH = 64;
+
+void pinToCpu(std::thread& pThread, unsigned pCpu) {
+#ifdef __linux__
+    unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(pCpu % cpus, &set);
+    pthread_setaffinity_np(pThread.native_handle(), sizeof(set), &set);
+#else
+    (void) pThread;
+    (void) pCpu;
+#endif
+}
+
+// Ends that find the ring full or empty yield, so both threads also make progress on a single CPU.
+struct RingLink {
+    aisdi::SpscRing<std::uint64_t, RING_CAPACITY> ring;
+
+    void put(std::uint64_t pValue) {
+        while (!ring.tryPush(pValue)) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::uint64_t take() {
+        std::uint64_t value;
+        while (!ring.tryPop(value)) {
+            std::this_thread::yield();
+        }
+        return value;
+    }
+};
+
+struct ChannelLink {
+    aisdi::Channel<std::uint64_t> channel{RING_CAPACITY};
+
+    void put(std::uint64_t pValue) {
+        channel.send(pValue);
+    }
+
+    std::uint64_t take() {
+        std::uint64_t value = 0;
+        channel.receive(value);
+        return value;
+    }
+};
+
+// Mutex guarded List, one node allocation per message.
+struct LockedListLink {
+    std::mutex mutex;
+    List<std::uint64_t> items;
+
+    void put(std::uint64_t pValue) {
+        std::lock_guard<std::mutex> lock(mutex);
+        items.append(pValue);
+    }
+
+    std::uint64_t take() {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!items.isEmpty())
+                    return items.popFirst();
+            }
+            std::this_thread::yield();
+        }
+    }
+};
+
+template<typename Link>
+void handoff(std::size_t&, std::size_t pCount) {
+    Link link;
+    std::uint64_t sum = 0;
+    std::thread producer([&link, pCount] {
+        for (std::size_t i = 0; i < pCount; i++) {
+            link.put(i);
+        }
+    });
+    std::thread consumer([&link, &sum, pCount] {
+        for (std::size_t i = 0; i < pCount; i++) {
+            sum += link.take();
+        }
+    });
+    pinToCpu(producer, 0);
+    pinToCpu(consumer, 1);
+    producer.join();
+    consumer.join();
+    doNotOptimize(sum);
+}
+
+void batchedHandoff(std::size_t&, std::size_t pCount) {
+    RingLink link;
+    std::uint64_t sum = 0;
+    std::thread producer([&link, pCount] {
+        std::array<std::uint64_t, RING_BATCH> batch;
+        for (std::size_t next = 0; next < pCount;) {
+            std::size_t size = std::min(RING_BATCH, pCount - next);
+            for (std::size_t i = 0; i < size; i++) {
+                batch[i] = next + i;
+            }
+            std::size_t pushed = link.ring.pushN(batch.begin(), size);
+            if (pushed == 0)
+                std::this_thread::yield();
+            next += pushed;
+        }
+    });
+    std::thread consumer([&link, &sum, pCount] {
+        std::array<std::uint64_t, RING_BATCH> batch;
+        for (std::size_t received = 0; received < pCount;) {
+            std::size_t popped = link.ring.popN(batch.begin(), RING_BATCH);
+            if (popped == 0)
+                std::this_thread::yield();
+            for (std::size_t i = 0; i < popped; i++) {
+                sum += batch[i];
+            }
+            received += popped;
+        }
+    });
+    pinToCpu(producer, 0);
+    pinToCpu(consumer, 1);
+    producer.join();
+    consumer.join();
+    doNotOptimize(sum);
+}
+
+// pCount ping-pong exchanges, each sends one message there and one back.
+template<typename Link>
+void roundTrip(std::size_t&, std::size_t pCount) {
+    Link ping;
+    Link pong;
+    std::thread echo([&ping, &pong, pCount] {
+        for (std::size_t i = 0; i < pCount; i++) {
+            pong.put(ping.take());
+        }
+    });
+    std::thread initiator([&ping, &pong, pCount] {
+        for (std::size_t i = 0; i < pCount; i++) {
+            ping.put(i);
+            doNotOptimize(pong.take());
+        }
+    });
+    pinToCpu(initiator, 0);
+    pinToCpu(echo, 1);
+    initiator.join();
+    echo.join();
+}
+
+void reportMessageRates(std::ostream& out, const std::vector<aisdi::bench::Result>& pResults) {
+    out << "Handoff throughput (" << std::thread::hardware_concurrency() << " CPUs)" << std::endl;
+    for (const aisdi::bench::Result& result : pResults) {
+        if (result.benchmark != "Handoff")
+            continue;
+        double messagesPerSecond = result.size * 1e9 / std::max(1.0, result.stats.median);
+        out << "  " << std::left << std::setw(16) << result.container << std::right << std::setw(10) << result.size
+            << std::fixed << std::setprecision(2) << std::setw(10) << messagesPerSecond / 1e6 << " M msg/s"
+            << std::endl;
+    }
+}
+
+// Fork-join sum: a worker splits its range in halves down to FORK_JOIN_GRAIN elements, keeps the left
+// half and offers the right one to the others.
+const std::size_t FORK_JOIN_WORKERS = 4;
+const std::size_t FORK_JOIN_GRAIN = 256;
+
+// Eight bytes, so deque slots stay lock-free atomics.
+struct Range {
+    std::uint32_t begin;
+    std::uint32_t end;
+};
+
+// Every worker owns a deque and steals from the others, starting with its right neighbour.
+class StealingPool {
+public:
+    explicit StealingPool(std::size_t pWorkers) {
+        for (std::size_t i = 0; i < pWorkers; i++) {
+            mDeques.emplace_back(new aisdi::WorkStealingDeque<Range>(64));
+        }
+    }
+
+    void push(std::size_t pWorker, const Range& pRange) {
+        mDeques[pWorker]->push(pRange);
+    }
+
+    bool take(std::size_t pWorker, Range& pRange) {
+        if (mDeques[pWorker]->pop(pRange))
+            return true;
+        for (std::size_t i = 1; i < mDeques.size(); i++) {
+            if (mDeques[(pWorker + i) % mDeques.size()]->steal(pRange))
+                return true;
+        }
+        return false;
+    }
+
+private:
+    std::vector<std::unique_ptr<aisdi::WorkStealingDeque<Range>>> mDeques;
+};
+
+// One mutex guarded List shared by all workers, newest range first.
+class CentralPool {
+public:
+    explicit CentralPool(std::size_t) { }
+
+    void push(std::size_t, const Range& pRange) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mRanges.append(pRange);
+    }
+
+    bool take(std::size_t, Range& pRange) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mRanges.isEmpty())
+            return false;
+        pRange = mRanges.popLast();
+        return true;
+    }
+
+private:
+    std::mutex mMutex;
+    List<Range> mRanges;
+};
+
+template<typename Pool>
+void forkJoinSum(Fixture<Vector<std::int64_t>>& fixture, std::size_t pCount) {
+    const std::int64_t* data = fixture.collection.data();
+    Pool pool(FORK_JOIN_WORKERS);
+    std::atomic<std::size_t> pending(1);
+    std::vector<std::int64_t> sums(FORK_JOIN_WORKERS);
+    pool.push(0, Range{0, static_cast<std::uint32_t>(pCount)});
+    std::vector<std::thread> workers;
+    for (std::size_t worker = 0; worker < FORK_JOIN_WORKERS; worker++) {
+        workers.emplace_back([&, worker] {
+            std::int64_t sum = 0;
+            Range range;
+            while (pending.load(std::memory_order_acquire) > 0) {
+                if (!pool.take(worker, range)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                while (range.end - range.begin > FORK_JOIN_GRAIN) {
+                    std::uint32_t middle = range.begin + (range.end - range.begin) / 2;
+                    pending.fetch_add(1, std::memory_order_relaxed);
+                    pool.push(worker, Range{middle, range.end});
+                    range.end = middle;
+                }
+                for (std::uint32_t i = range.begin; i < range.end; i++) {
+                    sum += data[i];
+                }
+                pending.fetch_sub(1, std::memory_order_release);
+            }
+            sums[worker] = sum;
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    doNotOptimize(sums);
+}
+
+// Cache lookups with Zipf distributed keys (s = 0.99) over ZIPF_KEYS keys, a miss puts the key.
+const std::size_t ZIPF_KEYS = 1000000;
+const std::size_t CACHE_CAPACITY = 65536;
+
+// The usual LRU on standard parts: a std::list of entries and a hash map of list positions,
+// where every hit erases the entry and pushes a copy to the front.
+class ListLru {
+public:
+    explicit ListLru(std::size_t pCapacity) : mCapacity(pCapacity) { }
+
+    int* get(int pKey) {
+        auto found = mIndex.find(pKey);
+        if (found == mIndex.end())
+            return nullptr;
+        std::pair<int, int> entry = *found->second;
+        mEntries.erase(found->second);
+        mEntries.push_front(entry);
+        found->second = mEntries.begin();
+        return &found->second->second;
+    }
+
+    void put(int pKey, int pValue) {
+        if (mEntries.size() == mCapacity) {
+            mIndex.erase(mEntries.back().first);
+            mEntries.pop_back();
+        }
+        mEntries.emplace_front(pKey, pValue);
+        mIndex[pKey] = mEntries.begin();
+    }
+
+private:
+    std::list<std::pair<int, int>> mEntries;
+    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> mIndex;
+    std::size_t mCapacity;
+};
+
+template<typename Cache>
+struct CacheFixture {
+    Cache cache{CACHE_CAPACITY};
+    std::vector<int> keys;
+};
+
+std::vector<int> zipfKeys(std::size_t pCount, unsigned pSeed) {
+    static const std::vector<double> cdf = [] {
+        std::vector<double> weights(ZIPF_KEYS);
+        double sum = 0;
+        for (std::size_t rank = 0; rank < ZIPF_KEYS; rank++) {
+            sum += 1.0 / std::pow(static_cast<double>(rank + 1), 0.99);
+            weights[rank] = sum;
+        }
+        for (double& weight : weights) {
+            weight /= sum;
+        }
+        return weights;
+    }();
+    std::default_random_engine eng(pSeed);
+    std::uniform_real_distribution<double> distr(0.0, 1.0);
+    std::vector<int> keys;
+    keys.reserve(pCount);
+    for (std::size_t i = 0; i < pCount; i++) {
+        auto rank = std::lower_bound(cdf.begin(), cdf.end(), distr(eng)) - cdf.begin();
+        keys.push_back(static_cast<int>(std::min<std::size_t>(rank, ZIPF_KEYS - 1)));
+    }
+    return keys;
+}
+
+template<typename Cache>
+std::size_t accessAll(Cache& pCache, const std::vector<int>& pKeys, std::size_t pCount) {
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < pCount; i++) {
+        if (pCache.get(pKeys[i]) != nullptr)
+            hits++;
+        else
+            pCache.put(pKeys[i], pKeys[i]);
+    }
+    return hits;
+}
+
+// The cache is warmed up with another stream of the same distribution.
+template<typename Cache>
+CacheFixture<Cache> withWarmCache(std::size_t pCount) {
+    CacheFixture<Cache> fixture;
+    accessAll(fixture.cache, zipfKeys(4 * CACHE_CAPACITY, 1), 4 * CACHE_CAPACITY);
+    fixture.keys = zipfKeys(pCount, static_cast<unsigned>(pCount));
+    return fixture;
+}
+
+template<typename Cache>
+void cacheAccess(CacheFixture<Cache>& fixture, std::size_t pCount) {
+    doNotOptimize(accessAll(fixture.cache, fixture.keys, pCount));
+}
+
+void reportHitRates(std::ostream& out, const std::vector<std::size_t>& pSizes) {
+    out << "Zipf hit rate (" << ZIPF_KEYS << " keys, capacity " << CACHE_CAPACITY << ")" << std::endl;
+    for (std::size_t size : pSizes) {
+        CacheFixture<aisdi::LruCache<int, int>> lru = withWarmCache<aisdi::LruCache<int, int>>(size);
+        CacheFixture<ListLru> reference = withWarmCache<ListLru>(size);
+        double lruRate = static_cast<double>(accessAll(lru.cache, lru.keys, size)) / size;
+        double referenceRate = static_cast<double>(accessAll(reference.cache, reference.keys, size)) / size;
+        out << "  " << size << " ops: LruCache " << lruRate << ", list+hashmap " << referenceRate << std::endl;
+    }
+}
+
+// Sizes sweep the cache hierarchy; pRandomAccessSizes limits IndexAccess and Seek where they are O(n) each.
+template<typename Collection, typename Setup>
+void runTraversal(aisdi::bench::Runner& runner, const std::string& pContainer, std::size_t pBytesPerElement,
+                  std::size_t pRandomAccessSizes, Setup setup) {
+    const std::string type = Element<typename Collection::value_type>::name();
+    std::vector<std::size_t> sizes = aisdi::bench::workingSetSizes(pBytesPerElement);
+    std::vector<std::size_t> randomAccessSizes(sizes.begin(),
+                                               sizes.begin() + std::min(pRandomAccessSizes, sizes.size()));
+    runner.run("ForwardScan", pContainer, type, sizes, setup, forwardScan<Collection>);
+    runner.run("ReverseScan", pContainer, type, sizes, setup, reverseScan<Collection>);
+    runner.run("IndexAccess", pContainer, type, randomAccessSizes, setup, indexAccess<Collection>);
+    runner.run("Seek", pContainer, type, randomAccessSizes, setup, seek<Collection>);
+}
+
+template<typename Collection>
+void runSuite(aisdi::bench::Runner& runner, const std::string& pContainer) {
+    const std::string type = Element<typename Collection::value_type>::name();
+    runner.runScaling("Append", pContainer, type, {1000, 10000, 100000},
+               withValues<Collection>, append<Collection>);
+    runner.runScaling("Prepend", pContainer, type, {1000, 10000},
+               withValues<Collection>, prepend<Collection>);
+    runner.runScaling("PopFirst", pContainer, type, {1000, 10000},
+               withFilledCollection<Collection>, popFirst<Collection>);
+    runner.runScaling("RandomInsert", pContainer, type, {1000, 5000, 10000},
+               withRandomPositions<Collection>, randomInsert<Collection>);
+}
+
+// Operations of collections used as queues, which have no positional insert.
+template<typename Collection>
+void runQueueSuite(aisdi::bench::Runner& runner, const std::string& pContainer) {
+    const std::string type = Element<typename Collection::value_type>::name();
+    runner.runScaling("Append", pContainer, type, {1000, 10000, 100000},
+               withValues<Collection>, append<Collection>);
+    runner.runScaling("Prepend", pContainer, type, {1000, 10000},
+               withValues<Collection>, prepend<Collection>);
+    runner.runScaling("PopFirst", pContainer, type, {1000, 10000},
+               withFilledCollection<Collection>, popFirst<Collection>);
+}
+
+template<typename Type>
+void runType(aisdi::bench::Runner& runner) {
+    runSuite<Vector<Type>>(runner, "Vector");
+    runSuite<List<Type>>(runner, "List");
+    runSuite<ArrayList<Type>>(runner, "ArrayList");
+    runQueueSuite<ForwardList<Type>>(runner, "ForwardList");
+    runSuite<IndexedSequence<Type>>(runner, "IndexedSequence");
+}
+
+template<typename Collection>
+void runTrace(aisdi::bench::Runner& runner, const std::string& pContainer,
+              const std::vector<aisdi::TraceEntry>& pTrace, std::vector<aisdi::bench::ReplayReport>& pReports) {
+    using aisdi::bench::ReplayFixture;
+    const std::string type = Element<typename Collection::value_type>::name();
+    std::size_t resultCount = runner.getResults().size();
+    runner.run("Replay", pContainer, type, {pTrace.size()},
+               [&pTrace](std::size_t) { return ReplayFixture<Collection>(pTrace); },
+               aisdi::bench::replay<Collection>);
+    if (runner.getResults().size() > resultCount)
+        pReports.push_back(aisdi::bench::replayWithLatencies<Collection>(pContainer, pTrace));
 }
 
 int main(int argc, char** argv) {
-    (void) argc;
-    (void) argv;
-    //prepend<Vector<int>>(12222);
-    //append<Vector<int>>(12222);
-    //prepend<List<int>>(12222);
-    //append<List<int>>(12222);
-
-/*    std::cout << "Append" << std::endl;
-
-    bmk::benchmark<> append_bm;
-    append_bm.run("Vector", 10, append<Vector<int>>, "Elements",
-                  {100, 1000, 10000, 50000, 100000, 500000, 1000000, 5000000, 10000000});
-    append_bm.run("List", 10, append<List<int>>, "Elements",
-                  {100, 1000, 10000, 50000, 100000, 500000, 1000000, 5000000, 10000000});
-    append_bm.serialize("Append", "append.txt");
-
-    std::cout << "Prepend" << std::endl;
-
-    bmk::benchmark<> prepend_bm;
-    prepend_bm.run("Vector", 1, prepend<Vector<int>>, "Elements",
-                   {100, 1000, 10000, 50000, 100000, 500000, 1000000});
-    prepend_bm.run("List", 1, prepend<List<int>>, "Elements",
-                   {100, 1000, 10000, 50000, 100000, 500000, 1000000});
-    prepend_bm.serialize("Prepend", "prepend.txt");
-
-    std::cout << "PopFirst" << std::endl;
-
-    bmk::benchmark<> pop_first_bm;
-    pop_first_bm.run("Vector", 1, popFirst<Vector<int>>, "Elements",
-                     {100, 1000, 10000, 50000, 100000, 500000, 1000000});
-    pop_first_bm.run("List", 1, popFirst<List<int>>, "Elements",
-                     {100, 1000, 10000, 50000, 100000, 500000, 1000000});
-    pop_first_bm.serialize("PopFirst", "popfirst.txt");
-
-    std::cout << "Random" << std::endl;
-*/
-    bmk::benchmark<> random_insert_bm;
-    random_insert_bm.run("Vector", 1, randomInsert<Vector<int>>, "Elements",
-                         {100, 1000, 10000, 20000, 40000, 50000, 100000});
-    random_insert_bm.run("List", 1, randomInsert<List<int>>, "Elements",
-                         {100, 1000, 10000, 20000, 40000, 50000, 100000});
-    random_insert_bm.serialize("RandomInsert", "randominsert.txt");
+    aisdi::bench::Options options;
+    try {
+        options = aisdi::bench::parseOptions(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl << aisdi::bench::usage();
+        return EXIT_FAILURE;
+    }
+
+    aisdi::bench::Runner runner(options);
+    if (options.perfCounters && !runner.hasPerfCounters())
+        std::cerr << "Hardware counters are unavailable (perf_event_open failed), reporting timings only"
+                  << std::endl;
+    else if (options.perfCounters && options.threads > 0)
+        std::cerr << "Hardware counters are collected for single threaded runs only" << std::endl;
+    std::vector<aisdi::bench::Result> baseline;
+    if (!options.baselinePath.empty()) {
+        std::ifstream in(options.baselinePath);
+        if (!in) {
+            std::cerr << "Can not open baseline " << options.baselinePath << std::endl;
+            return EXIT_FAILURE;
+        }
+        baseline = aisdi::bench::readJson(in);
+        runner.restrictTo(baseline);
+    }
+
+    std::vector<aisdi::TraceEntry> trace;
+    std::vector<aisdi::bench::ReplayReport> replayReports;
+    const std::vector<std::size_t> cacheSizes = {100000, 1000000};
+    bool reportCacheHits = false;
+    const std::vector<std::size_t> pipelineSizes = {10000, 100000};
+    bool reportPipeline = false;
+    bool reportHandoff = false;
+    if (!options.tracePath.empty()) {
+        std::ifstream in(options.tracePath);
+        if (!in) {
+            std::cerr << "Can not open trace " << options.tracePath << std::endl;
+            return EXIT_FAILURE;
+        }
+        try {
+            trace = aisdi::readTrace(in);
+        }
+        catch (const std::exception& e) {
+            std::cerr << options.tracePath << ": " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+        runTrace<Vector<std::string>>(runner, "Vector", trace, replayReports);
+        runTrace<List<std::string>>(runner, "List", trace, replayReports);
+        runTrace<IndexedSequence<std::string>>(runner, "IndexedSequence", trace, replayReports);
+        runTrace<GapVector<std::string>>(runner, "GapVector", trace, replayReports);
+    }
+    else {
+        runType<int>(runner);
+        runType<aisdi::bench::Pod64>(runner);
+        runType<aisdi::bench::Pod256>(runner);
+        runType<aisdi::bench::ShortString>(runner);
+        runType<aisdi::bench::LongString>(runner);
+        runType<aisdi::bench::MoveOnly>(runner);
+        runType<aisdi::bench::ExpensiveCopy>(runner);
+
+        // List nodes hold prev, next and the value, plus the allocator's header.
+        std::size_t listNodeBytes = sizeof(List<int>::NodeExtended) + sizeof(void*);
+        runTraversal<Vector<int>>(runner, "Vector", sizeof(int), 4, withSeekTargets<Vector<int>>);
+        runTraversal<List<int>>(runner, "List", listNodeBytes, 2, withSeekTargets<List<int>>);
+        runTraversal<List<int>>(runner, "ScatteredList", listNodeBytes, 2, withScatteredNodes);
+        runTraversal<ArrayList<int>>(runner, "ArrayList", sizeof(ArrayList<int>::Slot), 2,
+                                     withSeekTargets<ArrayList<int>>);
+        runner.run("Append", "Vector", "bool", {100000, 1000000},
+                   withValues<Vector<bool>>, append<Vector<bool>>);
+        runner.run("Append", "BitVector", "bool", {100000, 1000000},
+                   withValues<aisdi::BitVector>, append<aisdi::BitVector>);
+        runner.run("CountSet", "Vector", "bool", {1 << 16, 1 << 24},
+                   withFilledCollection<Vector<bool>>, countSet<Vector<bool>>);
+        runner.run("CountSet", "BitVector", "bool", {1 << 16, 1 << 24},
+                   withFilledCollection<aisdi::BitVector>, countSetWords);
+
+        using CompressedIds = aisdi::CompressedIntVector<std::int64_t>;
+        std::vector<std::size_t> idSizes = aisdi::bench::workingSetSizes(sizeof(std::int64_t));
+        runner.run("SumScan", "Vector", "int64", idSizes, withSortedIds<Vector<std::int64_t>>,
+                   sumScan<Vector<std::int64_t>>);
+        runner.run("SumScan", "CompressedIntVector", "int64", idSizes, withSortedIds<CompressedIds>,
+                   sumScan<CompressedIds>);
+        runner.run("BlockScan", "CompressedIntVector", "int64", idSizes, withSortedIds<CompressedIds>, sumBlocks);
+
+        // Both sets get the key counts that fit std::set in each cache level: tree nodes hold
+        // three links and a color besides the key, plus the allocator's header.
+        std::size_t treeNodeBytes = 4 * sizeof(void*) + sizeof(int) + sizeof(void*);
+        std::vector<std::size_t> keySizes = aisdi::bench::workingSetSizes(treeNodeBytes);
+        runner.run("Lookup", "FlatSet", "int", keySizes, withEvenKeys<aisdi::FlatSet<int>>,
+                   lookup<aisdi::FlatSet<int>>);
+        runner.run("Lookup", "std::set", "int", keySizes, withEvenKeys<std::set<int>>, lookup<std::set<int>>);
+        runner.run("InsertEach", "FlatSet", "int", {1000, 10000}, withNewKeys, insertEach);
+        runner.run("InsertBatch", "FlatSet", "int", {1000, 10000, 100000}, withNewKeys, insertBatch);
+
+#ifdef NDEBUG
+        // Sorts allocate the data and an equally large buffer; sizes past a gigabyte only run with --large.
+        // Unoptimized builds skip them altogether.
+        std::vector<std::size_t> sortSizes = {10000000};
+        std::vector<std::size_t> stableSortSizes = {1000000};
+        if (options.large) {
+            sortSizes.push_back(100000000);
+            stableSortSizes.push_back(10000000);
+        }
+        runner.run("Sort", "std::sort", "int", sortSizes, withShuffledValues<int>, stdSort<int>);
+        runner.run("Sort", "aisdi::sort", "int", sortSizes, withShuffledValues<int>, parallelSort<int>);
+        runner.run("Sort", "std::sort", "double", sortSizes, withRandomDoubles, stdSort<double>);
+        runner.run("Sort", "aisdi::sort", "double", sortSizes, withRandomDoubles, parallelSort<double>);
+        runner.run("StableSort", "std::stable_sort", "record", stableSortSizes,
+                   withShuffledValues<aisdi::bench::Record>, stdStableSortRecords);
+        runner.run("StableSort", "aisdi::sort", "record", stableSortSizes,
+                   withShuffledValues<aisdi::bench::Record>, parallelStableSortRecords);
+#endif
+
+        using BinaryHeap = aisdi::PriorityQueue<int>;
+        using QuaternaryHeap = aisdi::PriorityQueue<int, std::less<int>, 4>;
+        runner.run("Hold", "Vector(sorted)", "int", {1000, 10000}, withDeadlines<Vector<int>>, hold<Vector<int>>);
+        runner.run("Hold", "PriorityQueue<2>", "int", {1000, 10000, 100000, 1000000},
+                   withDeadlines<BinaryHeap>, hold<BinaryHeap>);
+        runner.run("Hold", "PriorityQueue<4>", "int", {1000, 10000, 100000, 1000000},
+                   withDeadlines<QuaternaryHeap>, hold<QuaternaryHeap>);
+        runner.run("Heapify", "PriorityQueue<2>", "int", {1000000}, withRandomKeys<BinaryHeap>,
+                   heapify<BinaryHeap>);
+        runner.run("PushEach", "PriorityQueue<2>", "int", {1000000}, withRandomKeys<BinaryHeap>,
+                   pushEach<BinaryHeap>);
+        using IndexedBinaryHeap = aisdi::IndexedPriorityQueue<int>;
+        using IndexedQuaternaryHeap = aisdi::IndexedPriorityQueue<int, std::less<int>, 4>;
+        runner.run("DecreaseKey", "IndexedQueue<2>", "int", {100000, 1000000},
+                   withQueuedHandles<IndexedBinaryHeap>, decreaseKeys<IndexedBinaryHeap>);
+        runner.run("DecreaseKey", "IndexedQueue<4>", "int", {100000, 1000000},
+                   withQueuedHandles<IndexedQuaternaryHeap>, decreaseKeys<IndexedQuaternaryHeap>);
+
+        std::size_t pipelineResults = runner.getResults().size();
+        runner.run("Pipeline", "PolledList", "message", pipelineSizes, withMessageCount,
+                   pipeline<PolledQueue, false>);
+        runner.run("Pipeline", "Channel", "message", pipelineSizes, withMessageCount,
+                   pipeline<aisdi::Channel<Message>, false>);
+        runner.run("Pipeline", "Channel(batch)", "message", pipelineSizes, withMessageCount,
+                   pipeline<aisdi::Channel<Message>, true>);
+        reportPipeline = runner.getResults().size() > pipelineResults;
+
+        std::size_t handoffResults = runner.getResults().size();
+        runner.run("Handoff", "List+mutex", "int64", {1000000}, withMessageCount, handoff<LockedListLink>);
+        runner.run("Handoff", "Channel", "int64", {1000000}, withMessageCount, handoff<ChannelLink>);
+        runner.run("Handoff", "SpscRing", "int64", {1000000}, withMessageCount, handoff<RingLink>);
+        runner.run("Handoff", "SpscRing(batch)", "int64", {1000000}, withMessageCount, batchedHandoff);
+        reportHandoff = runner.getResults().size() > handoffResults;
+        runner.run("RoundTrip", "Channel", "int64", {100000}, withMessageCount, roundTrip<ChannelLink>);
+        runner.run("RoundTrip", "SpscRing", "int64", {100000}, withMessageCount, roundTrip<RingLink>);
+
+        std::vector<std::size_t> forkJoinSizes = {1 << 20, 1 << 24};
+        runner.run("ForkJoinSum", "serial", "int64", forkJoinSizes, withSortedIds<Vector<std::int64_t>>,
+                   sumScan<Vector<std::int64_t>>);
+        runner.run("ForkJoinSum", "List+mutex", "int64", forkJoinSizes, withSortedIds<Vector<std::int64_t>>,
+                   forkJoinSum<CentralPool>);
+        runner.run("ForkJoinSum", "WorkStealingDeque", "int64", forkJoinSizes,
+                   withSortedIds<Vector<std::int64_t>>, forkJoinSum<StealingPool>);
+
+        std::size_t resultCount = runner.getResults().size();
+        runner.run("ZipfAccess", "LruCache", "int", cacheSizes, withWarmCache<aisdi::LruCache<int, int>>,
+                   cacheAccess<aisdi::LruCache<int, int>>);
+        runner.run("ZipfAccess", "list+hashmap", "int", cacheSizes, withWarmCache<ListLru>,
+                   cacheAccess<ListLru>);
+        reportCacheHits = runner.getResults().size() > resultCount;
+
+        std::vector<std::size_t> recordSizes = aisdi::bench::workingSetSizes(sizeof(aisdi::bench::Record));
+        runner.run("FieldScan", "Vector", "record", recordSizes,
+                   withFilledCollection<Vector<aisdi::bench::Record>>, priceScan);
+        runner.run("FieldScan", "SoAVector", "record", recordSizes, withRecordColumns, priceColumnScan);
+        std::size_t forwardNodeBytes = sizeof(ForwardList<int>::Node) + sizeof(void*);
+        runner.run("ForwardScan", "ForwardList", "int", aisdi::bench::workingSetSizes(forwardNodeBytes),
+                   withFilledCollection<ForwardList<int>>, forwardScan<ForwardList<int>>);
+    }
+    runner.report(std::cout);
+    if (options.threads > 0) {
+        std::cout << std::endl;
+        runner.reportScaling(std::cout);
+    }
+    if (!replayReports.empty()) {
+        std::cout << std::endl;
+        aisdi::bench::reportLatencies(std::cout, replayReports);
+    }
+    if (reportCacheHits) {
+        std::cout << std::endl;
+        reportHitRates(std::cout, cacheSizes);
+    }
+    if (reportPipeline) {
+        std::cout << std::endl;
+        reportPipelineLatencies(std::cout, pipelineSizes.back());
+    }
+    if (reportHandoff) {
+        std::cout << std::endl;
+        reportMessageRates(std::cout, runner.getResults());
+    }
+
+    if (!options.jsonPath.empty()) {
+        std::ofstream out(options.jsonPath);
+        aisdi::bench::writeJson(out, aisdi::bench::collectMetadata(), runner.getResults());
+    }
+
+    if (!options.baselinePath.empty()) {
+        std::cout << std::endl;
+        auto comparisons = aisdi::bench::compare(baseline, runner.getResults(), options.threshold);
+        if (aisdi::bench::reportComparison(std::cout, comparisons) > 0)
+            return EXIT_FAILURE;
+    }
 
     return 0;
 }
@@ -0,0 +1,223 @@
+#include <AllocationTracker.h>
+#include <ArrayList.h>
+#include <ForwardList.h>
+#include <LinkedList.h>
+#include <LruCache.h>
+#include <Vector.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+BOOST_AUTO_TEST_SUITE(AllocationTests)
+
+BOOST_AUTO_TEST_CASE(GivenTestProgram_WhenCheckingTracker_ThenHooksAreInstalled)
+{
+  BOOST_CHECK(aisdi::AllocationTracker::isInstalled());
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyVector_WhenAppendingUpToInitialCapacity_ThenFirstAppendAllocatesOnce)
+{
+  aisdi::AllocationScope scope;
+  aisdi::Vector<std::int32_t> collection;
+  for (int i = 0; i < 16; ++i)
+    collection.append(i);
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.allocations, 1);
+  BOOST_CHECK_EQUAL(delta.liveBytes, 16 * sizeof(std::int32_t));
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullVector_WhenAppending_ThenItReallocatesOnce)
+{
+  aisdi::Vector<std::int32_t> collection;
+  for (int i = 0; i < 16; ++i)
+    collection.append(i);
+
+  aisdi::AllocationScope scope;
+  collection.append(16);
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.allocations, 1);
+  BOOST_CHECK_EQUAL(delta.deallocations, 1);
+  BOOST_CHECK_EQUAL(delta.peakBytes, 32 * sizeof(std::int32_t));
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenAppendingItems_ThenEachItemAllocatesOneNode)
+{
+  aisdi::LinkedList<std::int32_t> collection;
+
+  aisdi::AllocationScope scope;
+  for (int i = 0; i < 100; ++i)
+    collection.append(i);
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.allocations, 100);
+  BOOST_CHECK_EQUAL(delta.liveBytes % 100, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenForwardList_WhenAppendingItems_ThenEachNodeHoldsOneLink)
+{
+  using List = aisdi::ForwardList<std::int64_t>;
+  List collection;
+
+  aisdi::AllocationScope scope;
+  for (int i = 0; i < 100; ++i)
+    collection.append(i);
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.allocations, 100);
+  BOOST_CHECK_EQUAL(delta.liveBytes, 100 * (sizeof(void*) + sizeof(std::int64_t)));
+}
+
+BOOST_AUTO_TEST_CASE(GivenArrayList_WhenErasingAndInserting_ThenFreedSlotsAreReused)
+{
+  aisdi::ArrayList<std::int32_t> collection;
+
+  aisdi::AllocationScope appendScope;
+  for (int i = 0; i < 16; ++i)
+    collection.append(i);
+  BOOST_CHECK_EQUAL(appendScope.delta().allocations, 1);
+
+  aisdi::AllocationScope reuseScope;
+  for (int i = 0; i < 100; ++i) {
+    collection.erase(collection.begin() + 3);
+    collection.insert(collection.begin() + 5, i);
+  }
+  BOOST_CHECK_EQUAL(reuseScope.delta().allocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyContainers_WhenConstructing_ThenNothingIsAllocated)
+{
+  aisdi::AllocationScope scope;
+  aisdi::Vector<std::int32_t> vector;
+  aisdi::LinkedList<std::int32_t> list;
+  aisdi::ForwardList<std::int32_t> forwardList;
+  aisdi::ArrayList<std::int32_t> arrayList;
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.allocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyContainers_WhenMoving_ThenNothingIsAllocated)
+{
+  aisdi::Vector<std::int32_t> vector = { 1, 2, 3 };
+  aisdi::LinkedList<std::int32_t> list = { 1, 2, 3 };
+
+  aisdi::AllocationScope scope;
+  aisdi::Vector<std::int32_t> movedVector{std::move(vector)};
+  aisdi::LinkedList<std::int32_t> movedList{std::move(list)};
+  vector = std::move(movedVector);
+  list = std::move(movedList);
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.allocations, 0);
+  BOOST_CHECK_EQUAL(vector.getSize(), 3);
+  BOOST_CHECK_EQUAL(list.getSize(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenContainers_WhenCheckingMoves_ThenTheyAreNoexcept)
+{
+  BOOST_CHECK(std::is_nothrow_move_constructible<aisdi::Vector<std::int32_t>>::value);
+  BOOST_CHECK(std::is_nothrow_move_assignable<aisdi::Vector<std::int32_t>>::value);
+  BOOST_CHECK(std::is_nothrow_move_constructible<aisdi::LinkedList<std::int32_t>>::value);
+  BOOST_CHECK(std::is_nothrow_move_assignable<aisdi::LinkedList<std::int32_t>>::value);
+}
+
+BOOST_AUTO_TEST_CASE(GivenVector_WhenCopying_ThenItAllocatesOnce)
+{
+  aisdi::Vector<std::int32_t> collection;
+  for (int i = 0; i < 1000; ++i)
+    collection.append(i);
+
+  aisdi::AllocationScope scope;
+  aisdi::Vector<std::int32_t> copy{collection};
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.allocations, 1);
+  BOOST_CHECK_EQUAL(delta.liveBytes, 1000 * sizeof(std::int32_t));
+}
+
+BOOST_AUTO_TEST_CASE(GivenLargeEnoughVector_WhenCopyAssigning_ThenBufferIsReused)
+{
+  aisdi::Vector<std::int32_t> collection = { 1, 2, 3, 4, 5 };
+  aisdi::Vector<std::int32_t> other;
+  for (int i = 0; i < 100; ++i)
+    other.append(i);
+
+  aisdi::AllocationScope scope;
+  other = collection;
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.allocations, 0);
+  BOOST_CHECK_EQUAL(other.getSize(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenCopyAssigning_ThenNodesComeFromOneAllocation)
+{
+  aisdi::LinkedList<std::int32_t> collection;
+  for (int i = 0; i < 1000; ++i)
+    collection.append(i);
+  aisdi::LinkedList<std::int32_t> other = { 1, 2, 3 };
+
+  aisdi::AllocationScope scope;
+  other = collection;
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.allocations, 1);
+  BOOST_CHECK_EQUAL(other.getSize(), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCopiedList_WhenErasingAndInserting_ThenSlabNodesAreReused)
+{
+  aisdi::LinkedList<std::int32_t> collection = { 1, 2, 3, 4 };
+  aisdi::LinkedList<std::int32_t> copy{collection};
+
+  aisdi::AllocationScope scope;
+  copy.erase(copy.begin() + 1);
+  copy.popLast();
+  copy.append(5);
+  copy.prepend(6);
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.allocations, 0);
+  BOOST_CHECK_EQUAL(delta.deallocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullCache_WhenPuttingNewKeys_ThenEvictedNodesAreReused)
+{
+  aisdi::LruCache<std::int32_t, std::int32_t> cache(64);
+  for (int i = 0; i < 64; ++i)
+    cache.put(i, i);
+
+  aisdi::AllocationScope scope;
+  for (int i = 64; i < 1000; ++i) {
+    cache.put(i, i);
+    cache.get(i - 10);
+  }
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.allocations, 0);
+  BOOST_CHECK_EQUAL(delta.deallocations, 0);
+  BOOST_CHECK_EQUAL(cache.getSize(), 64);
+}
+
+BOOST_AUTO_TEST_CASE(GivenContainers_WhenDestroyed_ThenAllBytesAreReleased)
+{
+  aisdi::AllocationScope scope;
+  {
+    aisdi::Vector<std::int32_t> vector = { 1, 2, 3 };
+    aisdi::LinkedList<std::int32_t> list = { 1, 2, 3 };
+    vector.append(4);
+    list.erase(list.begin());
+  }
+  aisdi::AllocationDelta delta = scope.delta();
+
+  BOOST_CHECK_EQUAL(delta.liveBytes, 0);
+  BOOST_CHECK_EQUAL(delta.allocations, delta.deallocations);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
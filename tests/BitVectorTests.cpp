@@ -0,0 +1,214 @@
+#include <BitVector.h>
+
+#include <cstdint>
+#include <initializer_list>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using aisdi::BitVector;
+
+BOOST_AUTO_TEST_SUITE(BitVectorTests)
+
+void thenCollectionContainsValues(const BitVector& collection, const std::vector<bool>& expected)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    BOOST_CHECK_MESSAGE(collection.get(i) == expected[i], "bit " << i);
+}
+
+// Pseudo-random bits long enough to span several words.
+std::vector<bool> randomBits(std::size_t count, unsigned seed)
+{
+  std::default_random_engine engine(seed);
+  std::bernoulli_distribution distribution(0.3);
+  std::vector<bool> bits;
+  for (std::size_t i = 0; i < count; ++i)
+    bits.push_back(distribution(engine));
+  return bits;
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const BitVector collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK_EQUAL(collection.popcount(), 0);
+  BOOST_CHECK_EQUAL(collection.findFirstSet(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenAppendingAcrossWords_ThenAllBitsAreKept)
+{
+  BitVector collection;
+  std::vector<bool> expected = randomBits(200, 1);
+
+  for (bool bit : expected)
+    collection.append(bit);
+
+  thenCollectionContainsValues(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAppendingWords_ThenBitsAreAppendedLowestFirst)
+{
+  BitVector collection = { true, false, true };
+
+  collection.appendBits(0xF0F0F0F0F0F0F0F0ull);
+  collection.appendBits(0x5, 3);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 70);
+  BOOST_CHECK(!collection.get(3));
+  BOOST_CHECK(collection.get(7));
+  BOOST_CHECK(collection.get(66));
+  BOOST_CHECK(collection.get(67));
+  BOOST_CHECK(!collection.get(68));
+  BOOST_CHECK(collection.get(69));
+  BOOST_CHECK_EQUAL(collection.popcount(), 2 + 32 + 2);
+  BOOST_CHECK_THROW(collection.appendBits(0, 65), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenInsertingAndPrepending_ThenLaterBitsAreShifted)
+{
+  std::vector<bool> expected = randomBits(130, 2);
+  BitVector collection(expected.begin(), expected.end());
+
+  collection.prepend(true);
+  expected.insert(expected.begin(), true);
+  collection.insert(collection.begin() + 63, true);
+  expected.insert(expected.begin() + 63, true);
+  collection.insert(collection.begin() + 100, false);
+  expected.insert(expected.begin() + 100, false);
+  collection.insert(collection.end(), true);
+  expected.push_back(true);
+
+  thenCollectionContainsValues(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenErasingRanges_ThenLaterBitsAreShifted)
+{
+  std::vector<bool> expected = randomBits(300, 3);
+  BitVector collection(expected.begin(), expected.end());
+
+  collection.erase(collection.begin() + 5);
+  expected.erase(expected.begin() + 5);
+  collection.erase(collection.begin() + 10, collection.begin() + 150);
+  expected.erase(expected.begin() + 10, expected.begin() + 150);
+  collection.erase(collection.begin() + 64, collection.end());
+  expected.erase(expected.begin() + 64, expected.end());
+
+  thenCollectionContainsValues(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenPopping_ThenBitsComeFromBothEnds)
+{
+  BitVector collection = { true, false, false, true, false };
+
+  BOOST_CHECK(collection.popFirst());
+  BOOST_CHECK(!collection.popLast());
+  BOOST_CHECK(collection.popLast());
+  thenCollectionContainsValues(collection, { false, false });
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPopping_ThenExceptionIsThrown)
+{
+  BitVector collection;
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::out_of_range);
+  BOOST_CHECK_THROW(collection.popLast(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPoppedBits_WhenAppendingAgain_ThenOldBitsDoNotReappear)
+{
+  BitVector collection;
+  for (int i = 0; i < 100; ++i)
+    collection.append(true);
+
+  collection.erase(collection.begin() + 10, collection.end());
+  collection.appendBits(0, 64);
+
+  BOOST_CHECK_EQUAL(collection.popcount(), 10);
+  BOOST_CHECK_EQUAL(collection.findNextSet(10), collection.getSize());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenFindingSetBits_ThenIndicesAreReturnedInOrder)
+{
+  BitVector collection;
+  collection.appendBits(0, 64);
+  collection.appendBits(0, 64);
+  collection.appendBits(0x9, 10);
+
+  BOOST_CHECK_EQUAL(collection.findFirstSet(), 128);
+  BOOST_CHECK_EQUAL(collection.findNextSet(129), 131);
+  BOOST_CHECK_EQUAL(collection.findNextSet(132), collection.getSize());
+  BOOST_CHECK_EQUAL(collection.popcount(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTwoCollections_WhenCombiningBitwise_ThenEveryBitIsCombined)
+{
+  std::vector<bool> left = randomBits(150, 4);
+  std::vector<bool> right = randomBits(150, 5);
+  std::vector<bool> expectedAnd, expectedOr, expectedXor;
+  for (std::size_t i = 0; i < left.size(); ++i) {
+    expectedAnd.push_back(left[i] && right[i]);
+    expectedOr.push_back(left[i] || right[i]);
+    expectedXor.push_back(left[i] != right[i]);
+  }
+  const BitVector other(right.begin(), right.end());
+
+  BitVector conjunction(left.begin(), left.end());
+  BitVector alternative(conjunction);
+  BitVector difference(conjunction);
+  conjunction &= other;
+  alternative |= other;
+  difference ^= other;
+
+  thenCollectionContainsValues(conjunction, expectedAnd);
+  thenCollectionContainsValues(alternative, expectedOr);
+  thenCollectionContainsValues(difference, expectedXor);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionsOfDifferentSize_WhenCombiningBitwise_ThenExceptionIsThrown)
+{
+  BitVector collection = { true, false };
+  const BitVector other = { true };
+
+  BOOST_CHECK_THROW(collection &= other, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIterator_WhenWritingThroughProxy_ThenBitIsChanged)
+{
+  BitVector collection = { false, false, true };
+
+  *collection.begin() = true;
+  auto last = collection.end() - 1;
+  *last = false;
+
+  thenCollectionContainsValues(collection, { true, false, false });
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopyAndMoveAssigning_ThenContentsAreTransferred)
+{
+  BitVector collection = { true, true, false };
+  BitVector larger;
+  for (int i = 0; i < 200; ++i)
+    larger.append(true);
+
+  larger = collection;
+  BitVector moved{std::move(collection)};
+  collection.append(true);
+
+  thenCollectionContainsValues(larger, { true, true, false });
+  BOOST_CHECK_EQUAL(larger.popcount(), 2);
+  thenCollectionContainsValues(moved, { true, true, false });
+  thenCollectionContainsValues(collection, { true });
+}
+
+// ConstIterator is tested via Iterator methods.
+// If Iterator methods are to be changed, then new ConstIterator tests are required.
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,191 @@
+#include <Channel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+BOOST_AUTO_TEST_SUITE(ChannelTests)
+
+BOOST_AUTO_TEST_CASE(GivenZeroCapacity_WhenCreatingChannel_ThenExceptionIsThrown)
+{
+  BOOST_CHECK_THROW(aisdi::Channel<int>(0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(GivenChannel_WhenSendingAndReceiving_ThenItemsKeepOrder)
+{
+  aisdi::Channel<std::string> channel(4);
+
+  BOOST_CHECK(channel.send("a"));
+  BOOST_CHECK(channel.send("b"));
+  std::string item;
+
+  BOOST_CHECK_EQUAL(channel.getSize(), 2);
+  BOOST_CHECK(channel.receive(item));
+  BOOST_CHECK_EQUAL(item, "a");
+  BOOST_CHECK(channel.tryReceive(item));
+  BOOST_CHECK_EQUAL(item, "b");
+  BOOST_CHECK(!channel.tryReceive(item));
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullChannel_WhenTryingToSend_ThenItemIsKept)
+{
+  aisdi::Channel<std::unique_ptr<int>> channel(1);
+  std::unique_ptr<int> first(new int(1));
+  std::unique_ptr<int> second(new int(2));
+
+  BOOST_CHECK(channel.trySend(std::move(first)));
+  BOOST_CHECK(!channel.trySend(std::move(second)));
+
+  BOOST_REQUIRE(second != nullptr);
+  BOOST_CHECK_EQUAL(*second, 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenClosedChannel_WhenReceiving_ThenRemainingItemsAreDrainedFirst)
+{
+  aisdi::Channel<int> channel(4);
+  channel.send(1);
+  channel.send(2);
+
+  channel.close();
+  channel.close();
+
+  int item = 0;
+  BOOST_CHECK(channel.isClosed());
+  BOOST_CHECK(!channel.send(3));
+  BOOST_CHECK(!channel.trySend(3));
+  BOOST_CHECK(channel.receive(item));
+  BOOST_CHECK_EQUAL(item, 1);
+  std::vector<int> rest;
+  BOOST_CHECK_EQUAL(channel.receiveMany(std::back_inserter(rest), 10), 1);
+  BOOST_CHECK_EQUAL(rest.at(0), 2);
+  BOOST_CHECK(!channel.receive(item));
+  BOOST_CHECK_EQUAL(channel.receiveMany(std::back_inserter(rest), 10), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBlockedReceiver_WhenChannelIsClosed_ThenReceiveFails)
+{
+  aisdi::Channel<int> channel(2);
+  std::atomic<bool> received(true);
+
+  std::thread receiver([&] {
+    int item = 0;
+    received = channel.receive(item);
+  });
+  channel.close();
+  receiver.join();
+
+  BOOST_CHECK(!received);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBlockedSender_WhenChannelIsClosed_ThenSendFails)
+{
+  aisdi::Channel<int> channel(1);
+  channel.send(1);
+  std::atomic<bool> sent(true);
+
+  std::thread sender([&] { sent = channel.send(2); });
+  channel.close();
+  sender.join();
+
+  BOOST_CHECK(!sent);
+  BOOST_CHECK_EQUAL(channel.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBatchLargerThanCapacity_WhenSendingMany_ThenItIsSentInParts)
+{
+  aisdi::Channel<int> channel(3);
+  std::vector<int> input(100);
+  std::iota(input.begin(), input.end(), 0);
+  std::vector<int> output;
+  std::atomic<bool> sentAll(false);
+
+  std::thread sender([&] {
+    sentAll = channel.sendMany(input.begin(), input.end()) == input.end();
+    channel.close();
+  });
+  std::vector<int> batch(8);
+  while (std::size_t count = channel.receiveMany(batch.begin(), batch.size())) {
+    BOOST_CHECK_LE(count, 3);
+    output.insert(output.end(), batch.begin(), batch.begin() + count);
+  }
+  sender.join();
+
+  BOOST_CHECK(sentAll);
+  BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(), input.begin(), input.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenClosedChannel_WhenSendingMany_ThenUnsentPositionIsReturned)
+{
+  aisdi::Channel<int> channel(2);
+  const std::vector<int> input = { 1, 2, 3 };
+
+  std::thread closer([&] {
+    while (channel.getSize() < 2)
+      std::this_thread::yield();
+    channel.close();
+  });
+  auto unsent = channel.sendMany(input.begin(), input.end());
+  closer.join();
+
+  BOOST_CHECK(unsent == input.begin() + 2);
+  BOOST_CHECK_EQUAL(channel.getSize(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyProducersAndConsumers_WhenTransferring_ThenEveryItemArrivesOnce)
+{
+  const int producers = 4;
+  const int perProducer = 5000;
+  aisdi::Channel<int> channel(16);
+  std::vector<std::vector<int>> received(3);
+  std::vector<std::thread> consumers;
+  for (auto& items : received) {
+    consumers.emplace_back([&channel, &items] {
+      int item = 0;
+      while (channel.receive(item))
+        items.push_back(item);
+    });
+  }
+
+  std::vector<std::thread> senders;
+  for (int producer = 0; producer < producers; ++producer) {
+    senders.emplace_back([&channel, producer] {
+      for (int i = 0; i < perProducer; ++i) {
+        int item = producer * perProducer + i;
+        if (i % 2 == 0)
+          channel.send(item);
+        else
+          channel.sendMany(&item, &item + 1);
+      }
+    });
+  }
+  for (auto& sender : senders)
+    sender.join();
+  channel.close();
+  for (auto& consumer : consumers)
+    consumer.join();
+
+  std::vector<int> all;
+  for (const auto& items : received) {
+    std::vector<int> last(producers, -1);
+    for (int item : items) {
+      BOOST_REQUIRE_LT(last[item / perProducer], item);
+      last[item / perProducer] = item;
+    }
+    all.insert(all.end(), items.begin(), items.end());
+  }
+  std::sort(all.begin(), all.end());
+  std::vector<int> expected(producers * perProducer);
+  std::iota(expected.begin(), expected.end(), 0);
+  BOOST_CHECK_EQUAL_COLLECTIONS(all.begin(), all.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,216 @@
+#include <CompressedIntVector.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedTypes = boost::mpl::list<std::int32_t, std::uint32_t, std::int64_t, std::uint64_t>;
+
+template <typename T>
+using LinearCollection = aisdi::CompressedIntVector<T>;
+
+BOOST_AUTO_TEST_SUITE(CompressedIntVectorTests)
+
+template <typename T>
+void thenCollectionContainsValues(const LinearCollection<T>& collection, const std::vector<T>& expected)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+  for (std::size_t i = 0; i < expected.size(); i += 7)
+    BOOST_CHECK_EQUAL(collection.get(i), expected[i]);
+}
+
+// Increasing values with random gaps, the shape of ids and timestamps.
+template <typename T>
+std::vector<T> sortedValues(std::size_t count, T first, unsigned maxGap)
+{
+  std::default_random_engine engine(static_cast<unsigned>(count));
+  std::uniform_int_distribution<unsigned> gap(1, maxGap);
+  std::vector<T> values;
+  T value = first;
+  for (std::size_t i = 0; i < count; ++i) {
+    values.push_back(value);
+    value = static_cast<T>(value + gap(engine));
+  }
+  return values;
+}
+
+template <typename T>
+std::vector<T> randomValues(std::size_t count)
+{
+  std::default_random_engine engine(static_cast<unsigned>(count));
+  std::uniform_int_distribution<T> distribution(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+  std::vector<T> values;
+  for (std::size_t i = 0; i < count; ++i)
+    values.push_back(distribution(engine));
+  return values;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK_EQUAL(collection.getBlockCount(), 0);
+  BOOST_CHECK_EQUAL(collection.getMemoryUsage(), 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenFewValues_WhenAppending_ThenTheyAreKeptInTheTail,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 5, 3, 9 };
+
+  thenCollectionContainsValues<T>(collection, { 5, 3, 9 });
+  BOOST_CHECK_EQUAL(collection.getBlockCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSortedValues_WhenAppending_ThenAllValuesAreDecoded,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> expected = sortedValues<T>(1000, 100, 50);
+
+  LinearCollection<T> collection(expected.begin(), expected.end());
+
+  thenCollectionContainsValues(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenRandomValues_WhenAppending_ThenFullWidthBlocksAreDecoded,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> expected = randomValues<T>(600);
+
+  LinearCollection<T> collection(expected.begin(), expected.end());
+
+  thenCollectionContainsValues(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenConstantValues_WhenAppending_ThenBlocksTakeNoWords,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> expected(512, 42);
+
+  LinearCollection<T> collection(expected.begin(), expected.end());
+
+  thenCollectionContainsValues(collection, expected);
+  // Only the block headers and the buffer of the block being filled remain.
+  BOOST_CHECK_LE(collection.getMemoryUsage(), LinearCollection<T>::BLOCK_SIZE * sizeof(T) + 4 * 32);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenDecreasingValues_WhenAppending_ThenNegativeDeltasAreDecoded,
+                              T,
+                              TestedTypes)
+{
+  std::vector<T> expected = sortedValues<T>(300, 7, 1000);
+  std::reverse(expected.begin(), expected.end());
+
+  LinearCollection<T> collection(expected.begin(), expected.end());
+
+  thenCollectionContainsValues(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSignedValuesAroundZero_WhenAppending_ThenSignsAreKept)
+{
+  std::vector<std::int64_t> expected;
+  for (std::int64_t i = -200; i < 200; ++i)
+    expected.push_back(i % 3 == 0 ? -i * 1000 : i);
+
+  LinearCollection<std::int64_t> collection(expected.begin(), expected.end());
+
+  thenCollectionContainsValues(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSortedIds_WhenCompressed_ThenTheyTakeSeveralTimesLessMemory)
+{
+  const std::vector<std::int64_t> ids = sortedValues<std::int64_t>(100000, 1000000, 64);
+
+  LinearCollection<std::int64_t> collection(ids.begin(), ids.end());
+
+  BOOST_CHECK_LT(collection.getMemoryUsage() * 4, ids.size() * sizeof(std::int64_t));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenDecodingBlocks_ThenBlocksMatchIteration,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> expected = sortedValues<T>(300, 0, 9);
+  LinearCollection<T> collection(expected.begin(), expected.end());
+
+  std::vector<T> decoded;
+  T block[LinearCollection<T>::BLOCK_SIZE];
+  for (std::size_t idx = 0; idx < collection.getBlockCount(); ++idx) {
+    std::size_t count = collection.decodeBlock(idx, block);
+    decoded.insert(decoded.end(), block, block + count);
+  }
+
+  BOOST_CHECK_EQUAL(collection.getBlockCount(), 3);
+  BOOST_CHECK(decoded == expected);
+  BOOST_CHECK_THROW(collection.decodeBlock(3, block), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenAccessingOutOfRange_ThenExceptionIsThrown,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+
+  BOOST_CHECK_THROW(collection.get(2), std::out_of_range);
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+  BOOST_CHECK_THROW(collection.begin() - 1, std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenSteppingBackAndJumping_ThenValuesMatch,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> expected = sortedValues<T>(400, 3, 20);
+  LinearCollection<T> collection(expected.begin(), expected.end());
+
+  auto it = collection.begin() + 257;
+  BOOST_CHECK_EQUAL(*it, expected[257]);
+  --it;
+  BOOST_CHECK_EQUAL(*it, expected[256]);
+  it--;
+  ++it;
+  ++it;
+  BOOST_CHECK_EQUAL(*it, expected[257]);
+  BOOST_CHECK_EQUAL(*(it - 200), expected[57]);
+  BOOST_CHECK(collection.begin() + 1000 == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenCopyingAndMoving_ThenContentsAreTransferred,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> expected = sortedValues<T>(200, 1, 5);
+  LinearCollection<T> collection(expected.begin(), expected.end());
+
+  LinearCollection<T> copy{collection};
+  LinearCollection<T> assigned;
+  assigned = copy;
+  LinearCollection<T> moved{std::move(collection)};
+  copy.append(7);
+  collection.append(9);
+
+  thenCollectionContainsValues(assigned, expected);
+  thenCollectionContainsValues(moved, expected);
+  BOOST_CHECK_EQUAL(copy.getSize(), 201);
+  thenCollectionContainsValues<T>(collection, { 9 });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,167 @@
+#include <FlatMap.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using Map = aisdi::FlatMap<int, std::string>;
+using Entry = Map::value_type;
+
+BOOST_AUTO_TEST_SUITE(FlatMapTests)
+
+void thenMapContains(const Map& map, const std::vector<std::pair<int, std::string>>& expected)
+{
+  BOOST_REQUIRE_EQUAL(map.getSize(), expected.size());
+  std::size_t idx = 0;
+  for (auto it = map.begin(); it != map.end(); ++it, ++idx) {
+    BOOST_CHECK_EQUAL(std::get<0>(*it), expected[idx].first);
+    BOOST_CHECK_EQUAL(std::get<1>(*it), expected[idx].second);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const Map map;
+
+  BOOST_CHECK(map.isEmpty());
+  BOOST_CHECK(map.begin() == map.end());
+  BOOST_CHECK(!map.contains(1));
+  BOOST_CHECK_EQUAL(map.keys().getSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenUnsortedEntries_WhenConstructing_ThenFirstEntryOfEveryKeyIsKept)
+{
+  const std::vector<std::pair<int, std::string>> input = { {3, "c"}, {1, "a"}, {3, "x"}, {2, "b"}, {1, "y"} };
+
+  const Map map(input.begin(), input.end());
+
+  thenMapContains(map, { {1, "a"}, {2, "b"}, {3, "c"} });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenInsertingSingleEntries_ThenExistingValuesAreKept)
+{
+  Map map;
+
+  BOOST_CHECK(map.insert(2, "two"));
+  BOOST_CHECK(map.insert(1, "one"));
+  BOOST_CHECK(!map.insert(2, "other"));
+
+  thenMapContains(map, { {1, "one"}, {2, "two"} });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenUsingSubscript_ThenMissingKeysAreInserted)
+{
+  Map map = { Entry(5, "five") };
+
+  map[3] = "three";
+  map[5] += "!";
+
+  thenMapContains(map, { {3, "three"}, {5, "five!"} });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenAccessingMissingKeyWithAt_ThenExceptionIsThrown)
+{
+  Map map = { Entry(1, "one") };
+  const Map& constMap = map;
+
+  BOOST_CHECK_EQUAL(constMap.at(1), "one");
+  map.at(1) = "uno";
+  BOOST_CHECK_EQUAL(constMap.at(1), "uno");
+  BOOST_CHECK_THROW(map.at(2), std::out_of_range);
+  BOOST_CHECK_THROW(constMap.at(0), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenFindingKeys_ThenIteratorPointsAtEntryOrEnd)
+{
+  Map map = { Entry(10, "a"), Entry(20, "b"), Entry(30, "c") };
+
+  auto it = map.find(20);
+  std::get<1>(*it) = "B";
+
+  BOOST_CHECK_EQUAL(map.at(20), "B");
+  BOOST_CHECK(map.find(25) == map.end());
+  BOOST_CHECK_EQUAL(std::get<0>(*map.lower_bound(25)), 30);
+  BOOST_CHECK(map.lower_bound(31) == map.end());
+  BOOST_CHECK(map.contains(10));
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenInsertingBatch_ThenNewKeysAreMergedAndOldValuesKept)
+{
+  Map map = { Entry(10, "a"), Entry(30, "c") };
+  const std::vector<Entry> batch = { Entry(40, "d"), Entry(30, "x"), Entry(20, "b"), Entry(5, "e") };
+
+  BOOST_CHECK_EQUAL(map.insertBatch(batch.begin(), batch.end()), 3);
+
+  thenMapContains(map, { {5, "e"}, {10, "a"}, {20, "b"}, {30, "c"}, {40, "d"} });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenReadingColumns_ThenKeysAndValuesAreAligned)
+{
+  Map map = { Entry(2, "b"), Entry(1, "a") };
+
+  for (std::string& value : map.values())
+    value += value;
+
+  BOOST_CHECK_EQUAL(map.keys()[0], 1);
+  BOOST_CHECK_EQUAL(map.keys()[1], 2);
+  BOOST_CHECK_EQUAL(map.values()[1], "bb");
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenErasing_ThenOnlyPresentKeysAreRemoved)
+{
+  Map map = { Entry(1, "a"), Entry(2, "b"), Entry(3, "c") };
+
+  BOOST_CHECK(map.erase(2));
+  BOOST_CHECK(!map.erase(2));
+  map.erase(map.begin());
+
+  thenMapContains(map, { {3, "c"} });
+  BOOST_CHECK_THROW(map.erase(map.end()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomBatches_WhenMerging_ThenMapMatchesStdMap)
+{
+  std::default_random_engine engine(11);
+  std::uniform_int_distribution<int> distribution(0, 3000);
+  aisdi::FlatMap<int, int> map;
+  std::map<int, int> expected;
+
+  for (int round = 0; round < 15; ++round) {
+    std::vector<std::pair<int, int>> batch;
+    for (int i = 0; i < 200; ++i)
+      batch.emplace_back(distribution(engine), round * 1000 + i);
+    map.insertBatch(batch.begin(), batch.end());
+    expected.insert(batch.begin(), batch.end());
+  }
+
+  BOOST_REQUIRE_EQUAL(map.getSize(), expected.size());
+  std::size_t idx = 0;
+  for (const auto& entry : expected) {
+    BOOST_CHECK_EQUAL(map.keys()[idx], entry.first);
+    BOOST_CHECK_EQUAL(map.values()[idx], entry.second);
+    ++idx;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenCopyingAndMoving_ThenContentsAreTransferred)
+{
+  Map map = { Entry(1, "a") };
+
+  Map copy{map};
+  Map moved{std::move(map)};
+  copy[2] = "b";
+  map[3] = "c";
+
+  thenMapContains(moved, { {1, "a"} });
+  thenMapContains(copy, { {1, "a"}, {2, "b"} });
+  thenMapContains(map, { {3, "c"} });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
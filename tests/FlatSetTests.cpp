@@ -0,0 +1,207 @@
+#include <FlatSet.h>
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedTypes = boost::mpl::list<std::int32_t, std::int64_t, std::string>;
+
+template <typename T>
+using FlatSet = aisdi::FlatSet<T>;
+
+BOOST_AUTO_TEST_SUITE(FlatSetTests)
+
+template <typename T>
+T key(int value)
+{
+  return static_cast<T>(value);
+}
+
+template <>
+std::string key<std::string>(int value)
+{
+  // Zero-padded, so string order matches the numeric one.
+  std::string text = std::to_string(value);
+  return std::string(6 - text.size(), '0') + text;
+}
+
+template <typename T>
+std::vector<T> keys(std::initializer_list<int> values)
+{
+  std::vector<T> result;
+  for (int value : values)
+    result.push_back(key<T>(value));
+  return result;
+}
+
+template <typename T>
+void thenSetContainsKeys(const FlatSet<T>& set, const std::vector<T>& expected)
+{
+  BOOST_CHECK_EQUAL(set.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(set.begin(), set.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSet_WhenCreatedWithDefaultConstructor_ThenItIsEmpty,
+                              T,
+                              TestedTypes)
+{
+  const FlatSet<T> set;
+
+  BOOST_CHECK(set.isEmpty());
+  BOOST_CHECK(set.begin() == set.end());
+  BOOST_CHECK(!set.contains(key<T>(1)));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenUnsortedKeys_WhenConstructing_ThenSetIsSortedAndUnique,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> input = keys<T>({ 5, 1, 4, 1, 3, 5 });
+
+  const FlatSet<T> set(input.begin(), input.end());
+
+  thenSetContainsKeys(set, keys<T>({ 1, 3, 4, 5 }));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSet_WhenInsertingSingleKeys_ThenOrderIsKept,
+                              T,
+                              TestedTypes)
+{
+  FlatSet<T> set;
+
+  BOOST_CHECK(set.insert(key<T>(20)));
+  BOOST_CHECK(set.insert(key<T>(10)));
+  BOOST_CHECK(set.insert(key<T>(30)));
+  BOOST_CHECK(!set.insert(key<T>(10)));
+
+  thenSetContainsKeys(set, keys<T>({ 10, 20, 30 }));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSet_WhenFindingKeys_ThenIteratorPointsAtKeyOrEnd,
+                              T,
+                              TestedTypes)
+{
+  const FlatSet<T> set = { key<T>(2), key<T>(4), key<T>(6) };
+
+  BOOST_CHECK_EQUAL(*set.find(key<T>(4)), key<T>(4));
+  BOOST_CHECK(set.find(key<T>(5)) == set.end());
+  BOOST_CHECK(set.find(key<T>(7)) == set.end());
+  BOOST_CHECK(set.contains(key<T>(2)));
+  BOOST_CHECK(!set.contains(key<T>(1)));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSet_WhenSearchingLowerBound_ThenFirstNotSmallerKeyIsReturned,
+                              T,
+                              TestedTypes)
+{
+  const FlatSet<T> set = { key<T>(2), key<T>(4), key<T>(6) };
+
+  BOOST_CHECK_EQUAL(*set.lower_bound(key<T>(1)), key<T>(2));
+  BOOST_CHECK_EQUAL(*set.lower_bound(key<T>(4)), key<T>(4));
+  BOOST_CHECK_EQUAL(*set.lower_bound(key<T>(5)), key<T>(6));
+  BOOST_CHECK(set.lower_bound(key<T>(7)) == set.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSet_WhenInsertingBatch_ThenOnlyNewKeysAreMerged,
+                              T,
+                              TestedTypes)
+{
+  FlatSet<T> set = { key<T>(10), key<T>(20), key<T>(30) };
+  const std::vector<T> batch = keys<T>({ 35, 5, 20, 15, 5, 40 });
+
+  BOOST_CHECK_EQUAL(set.insertBatch(batch.begin(), batch.end()), 4);
+
+  thenSetContainsKeys(set, keys<T>({ 5, 10, 15, 20, 30, 35, 40 }));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSet_WhenInsertingEmptyOrKnownBatch_ThenNothingIsAdded,
+                              T,
+                              TestedTypes)
+{
+  FlatSet<T> set = { key<T>(1), key<T>(2) };
+  const std::vector<T> known = keys<T>({ 2, 1, 2 });
+
+  BOOST_CHECK_EQUAL(set.insertBatch(known.begin(), known.begin()), 0);
+  BOOST_CHECK_EQUAL(set.insertBatch(known.begin(), known.end()), 0);
+
+  thenSetContainsKeys(set, keys<T>({ 1, 2 }));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSet_WhenErasingKeys_ThenOnlyPresentKeysAreRemoved,
+                              T,
+                              TestedTypes)
+{
+  FlatSet<T> set = { key<T>(1), key<T>(2), key<T>(3), key<T>(4) };
+
+  BOOST_CHECK(set.erase(key<T>(2)));
+  BOOST_CHECK(!set.erase(key<T>(7)));
+  set.erase(set.begin());
+
+  thenSetContainsKeys(set, keys<T>({ 3, 4 }));
+}
+
+BOOST_AUTO_TEST_CASE(GivenSet_WhenErasingEnd_ThenExceptionIsThrown)
+{
+  FlatSet<int> set = { 1 };
+
+  BOOST_CHECK_THROW(set.erase(set.end()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCustomComparator_WhenInserting_ThenKeysFollowIt)
+{
+  aisdi::FlatSet<int, std::greater<int>> set;
+  const std::vector<int> batch = { 3, 9, 1 };
+
+  set.insertBatch(batch.begin(), batch.end());
+  set.insert(5);
+
+  const std::vector<int> expected = { 9, 5, 3, 1 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(set.begin(), set.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(*set.lower_bound(4), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomBatches_WhenMerging_ThenSetMatchesStdSet)
+{
+  std::default_random_engine engine(7);
+  std::uniform_int_distribution<int> distribution(0, 5000);
+  FlatSet<int> set;
+  std::set<int> expected;
+
+  for (int round = 0; round < 20; ++round) {
+    std::vector<int> batch;
+    for (int i = 0; i < 300; ++i)
+      batch.push_back(distribution(engine));
+    std::size_t before = expected.size();
+    expected.insert(batch.begin(), batch.end());
+
+    BOOST_CHECK_EQUAL(set.insertBatch(batch.begin(), batch.end()), expected.size() - before);
+  }
+
+  BOOST_CHECK_EQUAL(set.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(set.data(), set.data() + set.getSize(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenSet_WhenCopyingAndMoving_ThenContentsAreTransferred)
+{
+  FlatSet<std::string> set = { "b", "a" };
+
+  FlatSet<std::string> copy{set};
+  FlatSet<std::string> moved{std::move(set)};
+  copy.insert("c");
+  set.insert("z");
+
+  thenSetContainsKeys(moved, { "a", "b" });
+  thenSetContainsKeys(copy, { "a", "b", "c" });
+  thenSetContainsKeys(set, { "z" });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,255 @@
+#include <ForwardList.h>
+
+#include <initializer_list>
+#include <complex>
+#include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedTypes = boost::mpl::list<std::int32_t, std::uint64_t, std::complex<std::int32_t>>;
+
+template <typename T>
+using LinearCollection = aisdi::ForwardList<T>;
+
+using std::begin;
+using std::end;
+
+BOOST_AUTO_TEST_SUITE(ForwardListTests)
+
+template <typename T>
+void thenCollectionContainsValues(const LinearCollection<T>& collection,
+                                  std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection),
+                                begin(expected), end(expected));
+  BOOST_CHECK_EQUAL(collection.getSize(), expected.size());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenGettingIterators_ThenBeginEqualsEnd,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK(begin(collection) == end(collection));
+  BOOST_CHECK(collection.cbegin() == collection.cend());
+  BOOST_CHECK(collection.cbeforeBegin() + 1 == collection.cend());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenAppendingAndPrepending_ThenItemsAreInOrder,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  collection.append(T{2});
+  collection.prepend(T{1});
+  collection.append(T{3});
+
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenPoppingFirst_ThenItemsComeOutInAppendOrder,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  BOOST_CHECK_EQUAL(collection.popFirst(), T{1});
+  BOOST_CHECK_EQUAL(collection.popFirst(), T{2});
+  thenCollectionContainsValues(collection, { 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenPoppingFirst_ThenExceptionIsThrown,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionEmptiedByPopping_WhenAppending_ThenTailIsReset,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+  collection.popFirst();
+  collection.popFirst();
+
+  collection.append(T{3});
+  collection.append(T{4});
+
+  thenCollectionContainsValues(collection, { 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenInsertingAfterBeforeBegin_ThenItemIsFirst,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 2, 3 };
+
+  collection.insertAfter(collection.cbeforeBegin(), T{1});
+
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenInsertingAfterMiddleItem_ThenItemIsPlacedAfterIt,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 4 };
+
+  collection.insertAfter(collection.begin() + 1, T{3});
+
+  thenCollectionContainsValues(collection, { 1, 2, 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenInsertingAfterLastItem_ThenAppendFollowsIt,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+
+  collection.insertAfter(collection.begin() + 1, T{3});
+  collection.append(T{4});
+
+  thenCollectionContainsValues(collection, { 1, 2, 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenInsertingAfterEnd_ThenExceptionIsThrown,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1 };
+
+  BOOST_CHECK_THROW(collection.insertAfter(collection.end(), T{2}), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenErasingAfterBeforeBegin_ThenFirstItemIsRemoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  collection.eraseAfter(collection.beforeBegin());
+
+  thenCollectionContainsValues(collection, { 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenErasingLastItem_ThenAppendFollowsNewLast,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  collection.eraseAfter(collection.begin() + 1);
+  collection.append(T{4});
+
+  thenCollectionContainsValues(collection, { 1, 2, 4 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenErasingAfterLastItemOrEnd_ThenExceptionIsThrown,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+
+  BOOST_CHECK_THROW(collection.eraseAfter(collection.begin() + 1), std::out_of_range);
+  BOOST_CHECK_THROW(collection.eraseAfter(collection.end()), std::out_of_range);
+  thenCollectionContainsValues(collection, { 1, 2 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenRange_WhenConstructing_ThenCollectionContainsItsItems,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> source = { T{1}, T{2}, T{3} };
+  std::istringstream stream("4 5");
+
+  LinearCollection<T> collection(source.begin(), source.end());
+  LinearCollection<int> fromStream{std::istream_iterator<int>(stream), std::istream_iterator<int>()};
+
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+  thenCollectionContainsValues(fromStream, { 4, 5 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenCopying_ThenCopyIsIndependent,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+  LinearCollection<T> other = { 7 };
+
+  LinearCollection<T> copy{collection};
+  other = collection;
+  collection.append(T{3});
+
+  thenCollectionContainsValues(copy, { 1, 2 });
+  thenCollectionContainsValues(other, { 1, 2 });
+  copy.append(T{5});
+  thenCollectionContainsValues(copy, { 1, 2, 5 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenMoving_ThenSourceIsEmptyAndUsable,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+  LinearCollection<T> other = { 7 };
+
+  LinearCollection<T> moved{std::move(collection)};
+  other = std::move(moved);
+  moved.append(T{3});
+  collection.append(T{4});
+
+  thenCollectionContainsValues(other, { 1, 2 });
+  thenCollectionContainsValues(moved, { 3 });
+  thenCollectionContainsValues(collection, { 4 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenDereferencingEndOrBeforeBegin_ThenExceptionIsThrown,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1 };
+
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+  BOOST_CHECK_THROW(*collection.beforeBegin(), std::out_of_range);
+  BOOST_CHECK_THROW(++collection.end(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenWritingThroughIt_ThenItemIsChanged,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+
+  auto it = collection.begin();
+  it++;
+  *it = T{5};
+
+  thenCollectionContainsValues(collection, { 1, 5 });
+}
+
+// ConstIterator is tested via Iterator methods.
+// If Iterator methods are to be changed, then new ConstIterator tests are required.
+
+BOOST_AUTO_TEST_SUITE_END()
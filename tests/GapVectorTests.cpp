@@ -0,0 +1,782 @@
+#include <GapVector.h>
+
+#include <initializer_list>
+#include <complex>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedTypes = boost::mpl::list<std::int32_t, std::uint64_t, std::complex<std::int32_t>>;
+
+template <typename T>
+using LinearCollection = aisdi::GapVector<T>;
+
+using std::begin;
+using std::end;
+
+BOOST_AUTO_TEST_SUITE(GapVectorTests)
+
+template <typename T>
+void thenCollectionContainsValues(const LinearCollection<T>& collection,
+                                  std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection),
+                                begin(expected), end(expected));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenAddingItem_ThenItIsNoLongerEmpty,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  collection.append(T{});
+
+  BOOST_CHECK(!collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenGettingIterators_ThenBeginEqualsEnd,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK(begin(collection) == end(collection));
+  BOOST_CHECK(const_cast<const LinearCollection<T>&>(collection).begin() == collection.end());
+  BOOST_CHECK(collection.cbegin() == collection.cend());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenGettingIterator_ThenBeginIsNotEnd,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.append(T{});
+
+  BOOST_CHECK(collection.begin() != collection.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithOneElement_WhenIterating_ThenElementIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.append(753);
+
+  auto it = collection.begin();
+
+  BOOST_CHECK_EQUAL(*it, 753);
+  BOOST_CHECK(++it == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenPostIncrementing_ThenPreviousPositionIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.append(T{});
+
+  auto it = collection.begin();
+  auto postIncrementedIt = it++;
+
+  BOOST_CHECK(postIncrementedIt == collection.begin());
+  BOOST_CHECK(it == collection.end());
+  BOOST_CHECK(postIncrementedIt == collection.cbegin());
+  BOOST_CHECK(it == collection.cend());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenPreIncrementing_ThenNewPositionIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.append(T{});
+
+  auto it = collection.begin();
+  auto preIncrementedIt = ++it;
+
+  BOOST_CHECK(preIncrementedIt == it);
+  BOOST_CHECK(it == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEndIterator_WhenIncrementing_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK_THROW(collection.end()++, std::out_of_range);
+  BOOST_CHECK_THROW(++(collection.end()), std::out_of_range);
+  BOOST_CHECK_THROW(collection.cend()++, std::out_of_range);
+  BOOST_CHECK_THROW(++(collection.cend()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEndIterator_WhenDecrementing_ThenIteratorPointsToLastItem,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.append(1);
+  collection.append(2);
+
+  auto it = collection.end();
+  --it;
+
+  BOOST_CHECK_EQUAL(*it, 2);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenPreDecrementing_ThenNewIteratorValueIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.append(1);
+
+  auto it = collection.end();
+  auto preDecremented = --it;
+
+  BOOST_CHECK(it == preDecremented);
+  BOOST_CHECK_EQUAL(*it, 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenPostDecrementing_ThenOldIteratorValueIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.append(1);
+
+  auto it = collection.end();
+  auto postDecremented = it--;
+
+  BOOST_CHECK(postDecremented == collection.end());
+  BOOST_CHECK_EQUAL(*it, 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenBeginIterator_WhenDecrementing_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK_THROW(collection.begin()--, std::out_of_range);
+  BOOST_CHECK_THROW(--(collection.begin()), std::out_of_range);
+  BOOST_CHECK_THROW(collection.cbegin()--, std::out_of_range);
+  BOOST_CHECK_THROW(--(collection.cbegin()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEndIterator_WhenDereferencing_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+  BOOST_CHECK_THROW(*collection.cend(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenConstIterator_WhenDereferencing_ThenItemIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 10, 20, 30 };
+
+  auto it = ++collection.cbegin();
+
+  BOOST_CHECK_EQUAL(*it, 20);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenDereferencing_ThenItemCanBeChanged,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 10, 20, 30 };
+
+  auto it = ++begin(collection);
+  *it = 500;
+
+  thenCollectionContainsValues(collection, { 10, 500, 30 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenAddingInteger_ThenAdvancedIteratorIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 2001, 2010, 2051 };
+
+  auto it = begin(collection);
+
+  BOOST_CHECK(it + 3 == end(collection));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenSubstractingInteger_ThenChangedIteratorIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 2001, 2010, 2051 };
+
+  auto it = end(collection);
+
+  BOOST_CHECK(it - 2 == ++begin(collection));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenAddingItem_ThenItemIsInCollection,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  collection.append(42);
+
+  thenCollectionContainsValues(collection, { 42 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenInitializingFromList_ThenAllItemsAreInCollection,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection = { 1410, 753, 1789 };
+
+  thenCollectionContainsValues(collection, { 1410, 753, 1789 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenCreatingCopy_ThenAllItemsAreCopied,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1410, 753, 1789 };
+  LinearCollection<T> other{collection};
+
+  collection.append(1024);
+
+  thenCollectionContainsValues(collection, { 1410, 753, 1789, 1024 });
+  thenCollectionContainsValues(other, { 1410, 753, 1789 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenCreatingCopy_ThenBothCollectionsAreEmpty,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  LinearCollection<T> other{collection};
+
+  BOOST_CHECK(other.isEmpty());
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenMovingToOther_ThenAllItemsAreMoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1410, 753, 1789 };
+  LinearCollection<T> other{std::move(collection)};
+
+  thenCollectionContainsValues(other, { 1410, 753, 1789 });
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenMovingToOther_ThenBothCollectionsAreEmpty,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  LinearCollection<T> other{std::move(collection)};
+
+  BOOST_CHECK(other.isEmpty());
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenAssigningToOther_ThenAllElementsAreCopied,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection = { 1, 2, 3, 4 };
+  LinearCollection<T> other = { 100, 200, 300, 400 };
+
+  other = collection;
+
+  thenCollectionContainsValues(other, { 1, 2, 3, 4 });
+  thenCollectionContainsValues(collection, { 1, 2, 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenAssigningToOther_ThenOtherCollectionIsEmpty,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection;
+  LinearCollection<T> other = { 100, 200, 300, 400 };
+
+  other = collection;
+
+  BOOST_CHECK(other.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenMoveAssigning_ThenAllElementsAreMoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3, 4 };
+  LinearCollection<T> other = { 100, 200, 300, 400 };
+
+  other = std::move(collection);
+
+  thenCollectionContainsValues(other, { 1, 2, 3, 4 });
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenMoveAssigning_ThenBothCollectionAreEmpty,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  LinearCollection<T> other = { 100, 200, 300, 400 };
+
+  other = std::move(collection);
+
+  BOOST_CHECK(other.isEmpty());
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenAppendingItem_ThenItemIsLast,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  collection.append(42);
+
+  thenCollectionContainsValues(collection, { 1, 2, 3, 42 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenPrependingItem_ThenItemIsAdded,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  collection.prepend(300);
+
+  thenCollectionContainsValues(collection, { 300 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPrependingItem_ThenItemIsFirst,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+
+  collection.prepend(300);
+
+  thenCollectionContainsValues(collection, { 300, 1, 2 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenGettingSize_ThenZeroIsReturned,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection;
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenGettingSize_ThenElementCountIsReturned,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection = { 12, 100, 500 };
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 3);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenChangingIt_ThenItsSizeAlsoChanges,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 72, 27, 77 };
+  collection.append(99);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 4);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPrependingItem_ThenSizeIsUpdated,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 72, 27, 77 };
+  collection.prepend(99);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 4);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenInsertingItem_ThenItemIsAdded,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  collection.insert(begin(collection), 42);
+
+  thenCollectionContainsValues(collection, { 42 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenInsertingAtBegin_ThenItemIsPrepended,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 11, 12, 13 };
+
+  collection.insert(begin(collection), 42);
+
+  thenCollectionContainsValues(collection, { 42, 11, 12, 13 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenInsertingAtEnd_ThenItemIsAppended,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 11, 12, 13 };
+
+  collection.insert(end(collection), 42);
+
+  thenCollectionContainsValues(collection, { 11, 12, 13, 42 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenInsertingInMiddle_ThenItemInserted,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 11, 12, 13 };
+
+  collection.insert(++begin(collection), 42);
+
+  thenCollectionContainsValues(collection, { 11, 42, 12, 13 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenInserting_ThenSizeIsUpdated,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 101, 102, 103 };
+
+  collection.insert(begin(collection), 27);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 4);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenPoppingFirst_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenPoppingLast_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithSingleItem_WhenPoppingFirst_ThenCollectionIsEmpty,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 420 };
+
+  collection.popFirst();
+
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithSingleItem_WhenPoppingLast_ThenCollectionIsEmpty,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 420 };
+
+  collection.popLast();
+
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPoppingFirst_ThenCollectionSizeIsReduced,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 14, 10 };
+
+  collection.popFirst();
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPoppingLast_ThenCollectionSizeIsReduced,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 14, 10 };
+
+  collection.popLast();
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPoppingFirst_ThenItemIsRemoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 300, 8, 480 };
+
+  collection.popFirst();
+
+  thenCollectionContainsValues(collection, { 8, 480 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPoppingLast_ThenItemIsRemoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 300, 8, 480 };
+
+  collection.popLast();
+
+  thenCollectionContainsValues(collection, { 300, 8 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPoppingFirst_ThenItemsIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 101, 202, 303 };
+
+  BOOST_CHECK_EQUAL(collection.popFirst(), 101);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPoppingLast_ThenItemsIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 101, 202, 303 };
+
+  BOOST_CHECK_EQUAL(collection.popLast(), 303);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenErasing_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK_THROW(collection.erase(collection.begin()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingEnd_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 20, 16 };
+
+  BOOST_CHECK_THROW(collection.erase(end(collection)), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingBegin_ThenItemIsRemoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 22, 41, 31 };
+
+  collection.erase(begin(collection));
+
+  thenCollectionContainsValues(collection, { 41, 31 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingLastItem_ThemItemIsRemoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 22, 45, 33 };
+
+  collection.erase(--end(collection));
+
+  thenCollectionContainsValues(collection, { 22, 45 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingMiddleItem_ThenItemIsRemoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 22, 51, 48 };
+
+  collection.erase(++begin(collection));
+
+  thenCollectionContainsValues(collection, { 22, 48 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasing_ThenSizeIsReduced,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1000, 500, 2, 900 };
+
+  collection.erase(begin(collection) + 2);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 3);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithSingleItem_WhenErasing_ThenCollectionIsEmpty,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1529 };
+
+  collection.erase(begin(collection));
+
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingEmptyRange_ThenNothingHappens,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 19, 42, 11 };
+
+  collection.erase(begin(collection), begin(collection));
+
+  thenCollectionContainsValues(collection, { 19, 42, 11 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingRangeFromBegin_ThenItemsAreRemoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 19, 42, 11 };
+
+  collection.erase(begin(collection), begin(collection) + 2);
+
+  thenCollectionContainsValues(collection, { 11 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_whenErasingRangeToEnd_ThenItemsAreRemoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 20, 1, 45 };
+
+  collection.erase(begin(collection) + 1, end(collection));
+
+  thenCollectionContainsValues(collection, { 20 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingSingleItemRange_ThenItemIsRemoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 2001, 2010, 2051, 3001 };
+
+  collection.erase(begin(collection) + 1, begin(collection) + 2);
+
+  thenCollectionContainsValues(collection, { 2001, 2051, 3001 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingWholeRange_ThenCollectinIsEmpty,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 400, 403, 404 };
+
+  collection.erase(begin(collection), end(collection));
+
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingRange_ThenSizeIsUpdated,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 23, 10, 20, 16 };
+
+  collection.erase(begin(collection) + 1, end(collection) - 1);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 2);
+}
+
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenInsertingAroundMovingCursor_ThenOrderIsPreserved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 6, 7 };
+
+  collection.insert(begin(collection) + 2, 3);
+  collection.insert(begin(collection) + 3, 4);
+  collection.insert(begin(collection) + 4, 5);
+  collection.insert(begin(collection), 0);
+  collection.insert(end(collection), 8);
+
+  thenCollectionContainsValues(collection, { 0, 1, 2, 3, 4, 5, 6, 7, 8 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenErasingAfterInsertingElsewhere_ThenGapIsMoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 10, 20, 30, 40, 50 };
+
+  collection.insert(begin(collection) + 1, 15);
+  collection.erase(begin(collection) + 4);
+  collection.erase(begin(collection));
+
+  thenCollectionContainsValues(collection, { 15, 20, 30, 50 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenInsertingManyItemsInTheMiddle_ThenItGrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 0, 1000 };
+
+  for (int i = 1; i < 100; ++i)
+    collection.insert(begin(collection) + i, i);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 101);
+  int expected = 0;
+  for (auto it = begin(collection); it != end(collection) - 1; ++it)
+    BOOST_CHECK_EQUAL(*it, expected++);
+  BOOST_CHECK_EQUAL(*(end(collection) - 1), 1000);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithGapInTheMiddle_WhenCopying_ThenItemsAreContiguous,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 4, 5 };
+  collection.insert(begin(collection) + 2, 3);
+
+  LinearCollection<T> other{collection};
+  LinearCollection<T> assigned = { 100 };
+  assigned = collection;
+
+  thenCollectionContainsValues(other, { 1, 2, 3, 4, 5 });
+  thenCollectionContainsValues(assigned, { 1, 2, 3, 4, 5 });
+}
+
+// ConstIterator is tested via Iterator methods.
+// If Iterator methods are to be changed, then new ConstIterator tests are required.
+
+BOOST_AUTO_TEST_SUITE_END()
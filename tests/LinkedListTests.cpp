@@ -3,6 +3,10 @@
 #include <initializer_list>
 #include <complex>
 #include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/test_tools.hpp>
@@ -716,6 +720,131 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingRange_ThenSizeI
   BOOST_CHECK_EQUAL(collection.getSize(), 2);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenRange_WhenCreatingCollection_ThenItContainsRangeItems,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> items = { 1410, 753, 1789 };
+
+  LinearCollection<T> collection(items.begin(), items.end());
+
+  thenCollectionContainsValues(collection, { 1410, 753, 1789 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyRange_WhenCreatingCollection_ThenItIsEmptyAndCanGrow,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> items;
+
+  LinearCollection<T> collection(items.begin(), items.end());
+  BOOST_CHECK(collection.isEmpty());
+
+  collection.append(42);
+  thenCollectionContainsValues(collection, { 42 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenAssigningShorterRange_ThenOnlyRangeItemsRemain,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3, 4, 5 };
+  const std::vector<T> items = { 10, 20 };
+
+  collection.assign(items.begin(), items.end());
+
+  thenCollectionContainsValues(collection, { 10, 20 });
+  BOOST_CHECK_EQUAL(collection.getSize(), 2);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenAssigningLongerRange_ThenOnlyRangeItemsRemain,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+  std::vector<T> items;
+  for (int i = 0; i < 40; ++i)
+    items.push_back(i);
+
+  collection.assign(items.begin(), items.end());
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 40);
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection), items.begin(), items.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenInputIteratorRange_WhenCreatingCollection_ThenItContainsReadItems)
+{
+  std::istringstream in("3 1 4 1 5");
+
+  LinearCollection<int> collection{std::istream_iterator<int>(in), std::istream_iterator<int>()};
+
+  thenCollectionContainsValues(collection, { 3, 1, 4, 1, 5 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenLongerCollection_WhenAssigningToShorter_ThenSizeIsCopied,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  for (int i = 0; i < 100; ++i)
+    collection.append(i);
+  LinearCollection<T> other = { 1, 2, 3 };
+
+  collection = other;
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 3);
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenMovedFromCollection_WhenAppending_ThenItIsUsableAgain,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+  LinearCollection<T> other{std::move(collection)};
+
+  collection.append(4);
+  collection.prepend(5);
+
+  thenCollectionContainsValues(collection, { 5, 4 });
+  thenCollectionContainsValues(other, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenSplicingElement_ThenItMovesAndIteratorStaysValid,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3, 4 };
+  auto third = collection.begin() + 2;
+
+  collection.splice(collection.begin(), third);
+  BOOST_CHECK_EQUAL(*third, T(3));
+  collection.splice(collection.end(), collection.begin() + 1);
+  collection.splice(collection.begin() + 1, collection.begin() + 1);
+
+  thenCollectionContainsValues(collection, { 3, 2, 4, 1 });
+  BOOST_CHECK_EQUAL(collection.getSize(), 4);
+  BOOST_CHECK_THROW(collection.splice(collection.begin(), collection.end()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenHandle_WhenElementIsSpliced_ThenHandleStillReachesIt,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+  typename LinearCollection<T>::Handle handle = collection.getHandle(collection.begin() + 2);
+  typename LinearCollection<T>::Handle empty;
+
+  collection.splice(collection.begin(), collection.getIterator(handle));
+  collection.get(handle) = T(7);
+
+  BOOST_CHECK(handle != empty);
+  BOOST_CHECK(!empty);
+  BOOST_CHECK(collection.getHandle(collection.begin()) == handle);
+  thenCollectionContainsValues(collection, { 7, 1, 2 });
+  BOOST_CHECK_THROW(collection.getHandle(collection.end()), std::out_of_range);
+}
+
 // ConstIterator is tested via Iterator methods.
 // If Iterator methods are to be changed, then new ConstIterator tests are required.
 
@@ -0,0 +1,216 @@
+#include <LruCache.h>
+
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using Cache = aisdi::LruCache<int, std::string>;
+
+BOOST_AUTO_TEST_SUITE(LruCacheTests)
+
+void thenCacheContainsKeys(const Cache& cache, const std::vector<int>& expected)
+{
+  BOOST_REQUIRE_EQUAL(cache.getSize(), expected.size());
+  std::vector<int> keys;
+  for (const auto& entry : cache)
+    keys.push_back(entry.key);
+  BOOST_CHECK_EQUAL_COLLECTIONS(keys.begin(), keys.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenZeroCapacity_WhenCreatingCache_ThenExceptionIsThrown)
+{
+  BOOST_CHECK_THROW(Cache(0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNewCache_WhenLookingUpKey_ThenItIsMissing)
+{
+  Cache cache(4);
+
+  BOOST_CHECK(cache.isEmpty());
+  BOOST_CHECK_EQUAL(cache.getCapacity(), 4);
+  BOOST_CHECK(cache.get(1) == nullptr);
+  BOOST_CHECK(!cache.touch(1));
+  BOOST_CHECK(!cache.erase(1));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCache_WhenPuttingKeys_ThenNewestComesFirst)
+{
+  Cache cache(4);
+
+  cache.put(1, "a");
+  cache.put(2, "b");
+  cache.put(3, "c");
+
+  thenCacheContainsKeys(cache, { 3, 2, 1 });
+  BOOST_CHECK_EQUAL(*cache.peek(1), "a");
+}
+
+BOOST_AUTO_TEST_CASE(GivenCache_WhenGettingKey_ThenItBecomesMostRecentlyUsed)
+{
+  Cache cache(4);
+  cache.put(1, "a");
+  cache.put(2, "b");
+  cache.put(3, "c");
+
+  *cache.get(1) += "!";
+  cache.touch(2);
+
+  thenCacheContainsKeys(cache, { 2, 1, 3 });
+  BOOST_CHECK_EQUAL(*cache.peek(1), "a!");
+}
+
+BOOST_AUTO_TEST_CASE(GivenCache_WhenPeekingKey_ThenOrderIsKept)
+{
+  Cache cache(4);
+  cache.put(1, "a");
+  cache.put(2, "b");
+
+  BOOST_CHECK_EQUAL(*cache.peek(1), "a");
+  BOOST_CHECK(cache.contains(1));
+  BOOST_CHECK(cache.peek(3) == nullptr);
+
+  thenCacheContainsKeys(cache, { 2, 1 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCache_WhenUpdatingKey_ThenValueIsReplacedAndMovedToFront)
+{
+  Cache cache(3);
+  cache.put(1, "a");
+  cache.put(2, "b");
+
+  cache.put(1, "x");
+
+  thenCacheContainsKeys(cache, { 1, 2 });
+  BOOST_CHECK_EQUAL(*cache.peek(1), "x");
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullCache_WhenPuttingNewKey_ThenLeastRecentlyUsedIsEvicted)
+{
+  std::vector<std::pair<int, std::string>> evicted;
+  Cache cache(3, [&evicted](const int& key, std::string& value) { evicted.emplace_back(key, value); });
+  cache.put(1, "a");
+  cache.put(2, "b");
+  cache.put(3, "c");
+  cache.get(1);
+
+  cache.put(4, "d");
+  cache.put(5, "e");
+
+  thenCacheContainsKeys(cache, { 5, 4, 1 });
+  BOOST_REQUIRE_EQUAL(evicted.size(), 2);
+  BOOST_CHECK_EQUAL(evicted[0].first, 2);
+  BOOST_CHECK_EQUAL(evicted[0].second, "b");
+  BOOST_CHECK_EQUAL(evicted[1].first, 3);
+  BOOST_CHECK(!cache.contains(2));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCache_WhenEvictingSeveralEntries_ThenOldestAreRemoved)
+{
+  std::vector<int> evicted;
+  Cache cache(5, [&evicted](const int& key, std::string&) { evicted.push_back(key); });
+  for (int i = 1; i <= 4; ++i)
+    cache.put(i, std::to_string(i));
+
+  BOOST_CHECK_EQUAL(cache.evictN(3), 3);
+  BOOST_CHECK_EQUAL(cache.evictN(3), 1);
+
+  BOOST_CHECK(cache.isEmpty());
+  const std::vector<int> expected = { 1, 2, 3, 4 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(evicted.begin(), evicted.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCache_WhenErasingKey_ThenCallbackIsNotCalled)
+{
+  int evictions = 0;
+  Cache cache(3, [&evictions](const int&, std::string&) { ++evictions; });
+  cache.put(1, "a");
+  cache.put(2, "b");
+
+  BOOST_CHECK(cache.erase(1));
+  cache.put(3, "c");
+
+  thenCacheContainsKeys(cache, { 3, 2 });
+  BOOST_CHECK_EQUAL(evictions, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomOperations_WhenComparedWithReferenceLru_ThenContentsMatch)
+{
+  const std::size_t capacity = 50;
+  aisdi::LruCache<int, int> cache(capacity);
+  std::list<std::pair<int, int>> order;
+  std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index;
+  std::default_random_engine engine(5);
+  std::uniform_int_distribution<int> keys(0, 120);
+  std::uniform_int_distribution<int> operations(0, 9);
+
+  for (int step = 0; step < 20000; ++step) {
+    int key = keys(engine);
+    int operation = operations(engine);
+    auto found = index.find(key);
+    if (operation < 4) {
+      int* value = cache.get(key);
+      BOOST_REQUIRE_EQUAL(value != nullptr, found != index.end());
+      if (found != index.end()) {
+        BOOST_REQUIRE_EQUAL(*value, found->second->second);
+        order.splice(order.begin(), order, found->second);
+      }
+    }
+    else if (operation < 9) {
+      cache.put(key, step);
+      if (found != index.end()) {
+        found->second->second = step;
+        order.splice(order.begin(), order, found->second);
+      }
+      else {
+        if (order.size() == capacity) {
+          index.erase(order.back().first);
+          order.pop_back();
+        }
+        order.emplace_front(key, step);
+        index[key] = order.begin();
+      }
+    }
+    else {
+      BOOST_REQUIRE_EQUAL(cache.erase(key), found != index.end());
+      if (found != index.end()) {
+        order.erase(found->second);
+        index.erase(found);
+      }
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(cache.getSize(), order.size());
+  auto expected = order.begin();
+  for (const auto& entry : cache) {
+    BOOST_CHECK_EQUAL(entry.key, expected->first);
+    BOOST_CHECK_EQUAL(entry.value, expected->second);
+    ++expected;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenCache_WhenCopyingAndMoving_ThenEntriesAndOrderAreTransferred)
+{
+  Cache cache(3);
+  cache.put(1, "a");
+  cache.put(2, "b");
+  cache.get(1);
+
+  Cache copy{cache};
+  Cache moved{std::move(cache)};
+  copy.put(3, "c");
+  copy.put(4, "d");
+
+  thenCacheContainsKeys(moved, { 1, 2 });
+  thenCacheContainsKeys(copy, { 4, 3, 1 });
+  BOOST_CHECK(cache.isEmpty());
+  BOOST_CHECK(!cache.contains(1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,153 @@
+#include <OperationTrace.h>
+#include <TraceReplay.h>
+#include <LinkedList.h>
+#include <Vector.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedTypes = boost::mpl::list<aisdi::Vector<int>, aisdi::LinkedList<int>>;
+
+template <typename T>
+using Recorded = aisdi::Recording<aisdi::Vector<T>>;
+
+using aisdi::TraceEntry;
+using aisdi::TraceOperation;
+
+BOOST_AUTO_TEST_SUITE(OperationTraceTests)
+
+template <typename Collection>
+std::vector<int> contents(const Collection& collection)
+{
+  return std::vector<int>(collection.begin(), collection.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenRecording_WhenInserting_ThenPositionsAndPayloadsAreRecorded)
+{
+  aisdi::Recording<aisdi::Vector<std::string>> collection;
+  collection.append("abc");
+  collection.prepend("de");
+  collection.insert(collection.begin() + 1, "fghij");
+
+  const std::vector<TraceEntry> expected = {
+    {TraceOperation::Append, 0, 0, 3},
+    {TraceOperation::Prepend, 0, 0, 2},
+    {TraceOperation::Insert, 1, 0, 5}
+  };
+  BOOST_CHECK(collection.getTrace() == expected);
+  BOOST_CHECK_EQUAL(collection.getSize(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRecording_WhenErasing_ThenErasedRangesAreRecorded)
+{
+  Recorded<int> collection;
+  for (int i = 0; i < 10; ++i)
+    collection.append(i);
+  collection.clearTrace();
+
+  collection.popFirst();
+  collection.popLast();
+  collection.erase(collection.begin() + 2);
+  collection.erase(collection.begin() + 1, collection.begin() + 4);
+
+  const std::vector<TraceEntry> expected = {
+    {TraceOperation::PopFirst, 0, 1, 0},
+    {TraceOperation::PopLast, 8, 1, 0},
+    {TraceOperation::Erase, 2, 1, 0},
+    {TraceOperation::EraseRange, 1, 3, 0}
+  };
+  BOOST_CHECK(collection.getTrace() == expected);
+  BOOST_CHECK_EQUAL(collection.getSize(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRecording_WhenOperationThrows_ThenNothingIsRecorded)
+{
+  Recorded<int> collection;
+  BOOST_CHECK_THROW(collection.popFirst(), std::out_of_range);
+  BOOST_CHECK(collection.getTrace().empty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenRecordedTrace_WhenWrittenAndRead_ThenEntriesAreEqual)
+{
+  Recorded<int> collection;
+  for (int i = 0; i < 5; ++i)
+    collection.prepend(i);
+  collection.insert(collection.begin() + 2, 7);
+  collection.erase(collection.begin(), collection.begin() + 3);
+
+  std::stringstream stream;
+  collection.writeTrace(stream);
+
+  BOOST_CHECK(aisdi::readTrace(stream) == collection.getTrace());
+}
+
+BOOST_AUTO_TEST_CASE(GivenMalformedTrace_WhenReading_ThenExceptionIsThrown)
+{
+  std::istringstream noHeader("append 0 0 4\n");
+  BOOST_CHECK_THROW(aisdi::readTrace(noHeader), std::runtime_error);
+
+  std::istringstream unknownOperation("aisdi-trace 1\nappend 0 0 4\nshuffle 0 0 0\n");
+  BOOST_CHECK_THROW(aisdi::readTrace(unknownOperation), std::runtime_error);
+
+  std::istringstream missingField("aisdi-trace 1\ninsert 0 0\n");
+  BOOST_CHECK_THROW(aisdi::readTrace(missingField), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTraceErasingPastTheEnd_WhenReading_ThenExceptionIsThrown)
+{
+  std::istringstream erasePastEnd("aisdi-trace 1\nappend 0 0 4\nappend 1 0 4\nerase-range 1 2 0\n");
+  BOOST_CHECK_THROW(aisdi::readTrace(erasePastEnd), std::runtime_error);
+
+  std::istringstream popEmpty("aisdi-trace 1\npop-last 0 1 0\n");
+  BOOST_CHECK_THROW(aisdi::readTrace(popEmpty), std::runtime_error);
+
+  // A negative length reads as SIZE_MAX, so position + length wraps around.
+  std::istringstream wrappingLength("aisdi-trace 1\nappend 0 0 4\nappend 1 0 4\nerase-range 1 -1 0\n");
+  BOOST_CHECK_THROW(aisdi::readTrace(wrappingLength), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenRecordedTrace_WhenReplayed_ThenContentsMatchRecordedCollection,
+                              Collection, TestedTypes)
+{
+  // Replay inserts the k-th inserted value as k, so record with the same values.
+  Recorded<int> recorded;
+  int next = 0;
+  for (int i = 0; i < 20; ++i)
+    recorded.append(next++);
+  for (int i = 0; i < 10; ++i)
+    recorded.insert(recorded.begin() + (i * 7) % recorded.getSize(), next++);
+  recorded.prepend(next++);
+  recorded.popLast();
+  recorded.erase(recorded.begin() + 5);
+  recorded.erase(recorded.begin() + 3, recorded.begin() + 9);
+  recorded.popFirst();
+
+  aisdi::bench::ReplayFixture<Collection> fixture(recorded.getTrace());
+  aisdi::bench::replay(fixture, recorded.getTrace().size());
+
+  BOOST_CHECK(contents(fixture.collection) == contents(recorded));
+}
+
+BOOST_AUTO_TEST_CASE(GivenTrace_WhenReplayedWithLatencies_ThenEveryOperationIsCounted)
+{
+  std::istringstream in("aisdi-trace 1\nappend 0 0 4\nappend 1 0 4\ninsert 1 0 4\npop-first 0 1 0\n");
+  std::vector<TraceEntry> trace = aisdi::readTrace(in);
+
+  aisdi::bench::ReplayReport report =
+    aisdi::bench::replayWithLatencies<aisdi::Vector<std::string>>("Vector", trace);
+
+  BOOST_CHECK_EQUAL(report.operations, 4);
+  BOOST_REQUIRE_EQUAL(report.latencies.size(), 3);
+  BOOST_CHECK(report.latencies[0].operation == TraceOperation::Append);
+  BOOST_CHECK_EQUAL(report.latencies[0].count, 2);
+  BOOST_CHECK_EQUAL(report.latencies[2].count, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
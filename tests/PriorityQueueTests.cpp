@@ -0,0 +1,227 @@
+#include <PriorityQueue.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedQueues = boost::mpl::list<aisdi::PriorityQueue<int>, aisdi::PriorityQueue<int, std::less<int>, 4>,
+                                      aisdi::PriorityQueue<int, std::less<int>, 3>>;
+
+using IndexedQueues = boost::mpl::list<aisdi::IndexedPriorityQueue<int>,
+                                       aisdi::IndexedPriorityQueue<int, std::less<int>, 4>>;
+
+BOOST_AUTO_TEST_SUITE(PriorityQueueTests)
+
+std::vector<int> randomValues(std::size_t count, int maximum)
+{
+  std::default_random_engine engine(static_cast<unsigned>(count));
+  std::uniform_int_distribution<int> distribution(0, maximum);
+  std::vector<int> values;
+  for (std::size_t i = 0; i < count; ++i)
+    values.push_back(distribution(engine));
+  return values;
+}
+
+template <typename Queue>
+std::vector<int> popAll(Queue& queue)
+{
+  std::vector<int> values;
+  while (!queue.isEmpty())
+    values.push_back(queue.pop());
+  return values;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyQueue_WhenTakingTop_ThenExceptionIsThrown,
+                              Queue,
+                              TestedQueues)
+{
+  Queue queue;
+
+  BOOST_CHECK(queue.isEmpty());
+  BOOST_CHECK_THROW(queue.top(), std::out_of_range);
+  BOOST_CHECK_THROW(queue.pop(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenQueue_WhenPushing_ThenTopIsTheSmallestValue,
+                              Queue,
+                              TestedQueues)
+{
+  Queue queue;
+
+  queue.push(5);
+  queue.push(3);
+  queue.push(8);
+  queue.push(3);
+
+  BOOST_CHECK_EQUAL(queue.getSize(), 4);
+  BOOST_CHECK_EQUAL(queue.top(), 3);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenRandomValues_WhenPushingAndPopping_ThenTheyComeOutSorted,
+                              Queue,
+                              TestedQueues)
+{
+  std::vector<int> values = randomValues(1000, 100);
+  Queue queue;
+
+  for (int value : values)
+    queue.push(value);
+
+  std::sort(values.begin(), values.end());
+  std::vector<int> popped = popAll(queue);
+  BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), values.begin(), values.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenRange_WhenConstructing_ThenItIsHeapified,
+                              Queue,
+                              TestedQueues)
+{
+  std::vector<int> values = randomValues(777, 5000);
+
+  Queue queue(values.begin(), values.end());
+
+  std::sort(values.begin(), values.end());
+  std::vector<int> popped = popAll(queue);
+  BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), values.begin(), values.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenQueue_WhenPushingSmallAndLargeBatches_ThenAllValuesAreOrdered,
+                              Queue,
+                              TestedQueues)
+{
+  Queue queue = { 50, 10, 30 };
+  const std::vector<int> small = { 20, 5 };
+  const std::vector<int> large = randomValues(100, 60);
+
+  queue.pushBatch(small.begin(), small.end());
+  queue.pushBatch(large.begin(), large.end());
+
+  std::vector<int> expected = { 50, 10, 30, 20, 5 };
+  expected.insert(expected.end(), large.begin(), large.end());
+  std::sort(expected.begin(), expected.end());
+  std::vector<int> popped = popAll(queue);
+  BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenGreaterComparator_WhenPopping_ThenLargestComesFirst)
+{
+  aisdi::PriorityQueue<std::string, std::greater<std::string>> queue = { "b", "c", "a" };
+
+  BOOST_CHECK_EQUAL(queue.pop(), "c");
+  BOOST_CHECK_EQUAL(queue.pop(), "b");
+  BOOST_CHECK_EQUAL(queue.pop(), "a");
+}
+
+BOOST_AUTO_TEST_CASE(GivenMoveOnlyValues_WhenPushingAndPopping_ThenTheyAreMoved)
+{
+  auto less = [](const std::unique_ptr<int>& left, const std::unique_ptr<int>& right) { return *left < *right; };
+  aisdi::PriorityQueue<std::unique_ptr<int>, decltype(less), 4> queue(less);
+
+  for (int value : { 4, 1, 3 })
+    queue.push(std::unique_ptr<int>(new int(value)));
+
+  BOOST_CHECK_EQUAL(*queue.pop(), 1);
+  BOOST_CHECK_EQUAL(*queue.top(), 3);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIndexedQueue_WhenDecreasingKey_ThenElementMovesToTop,
+                              Queue,
+                              IndexedQueues)
+{
+  Queue queue;
+  auto first = queue.push(10);
+  auto second = queue.push(20);
+  auto third = queue.push(30);
+
+  queue.decreaseKey(third, 5);
+
+  BOOST_CHECK_EQUAL(queue.topHandle(), third);
+  BOOST_CHECK_EQUAL(queue.get(third), 5);
+  BOOST_CHECK_THROW(queue.decreaseKey(second, 25), std::invalid_argument);
+  BOOST_CHECK_EQUAL(queue.pop(), 5);
+  BOOST_CHECK_EQUAL(queue.topHandle(), first);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIndexedQueue_WhenErasingAndPopping_ThenHandlesAreFreedAndReused,
+                              Queue,
+                              IndexedQueues)
+{
+  Queue queue;
+  auto first = queue.push(1);
+  auto second = queue.push(2);
+
+  queue.erase(second);
+  BOOST_CHECK(!queue.contains(second));
+  BOOST_CHECK_THROW(queue.get(second), std::out_of_range);
+  BOOST_CHECK_THROW(queue.erase(second), std::out_of_range);
+
+  BOOST_CHECK_EQUAL(queue.push(3), second);
+  queue.pop();
+  BOOST_CHECK(!queue.contains(first));
+  BOOST_CHECK_EQUAL(queue.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenRandomOperations_WhenComparedWithOrderedSet_ThenTopsMatch,
+                              Queue,
+                              IndexedQueues)
+{
+  std::default_random_engine engine(9);
+  std::uniform_int_distribution<int> values(0, 10000);
+  std::uniform_int_distribution<int> operations(0, 4);
+  Queue queue;
+  std::set<std::pair<int, std::size_t>> expected;
+  std::vector<std::size_t> handles;
+
+  for (int step = 0; step < 20000; ++step) {
+    int operation = operations(engine);
+    if (operation <= 1 || handles.empty()) {
+      int value = values(engine);
+      std::size_t handle = queue.push(value);
+      handles.push_back(handle);
+      expected.emplace(value, handle);
+    }
+    else {
+      std::size_t idx = std::uniform_int_distribution<std::size_t>(0, handles.size() - 1)(engine);
+      std::size_t handle = handles[idx];
+      int old = queue.get(handle);
+      expected.erase(std::make_pair(old, handle));
+      if (operation == 2) {
+        int value = old - values(engine) / 10;
+        queue.decreaseKey(handle, value);
+        expected.emplace(value, handle);
+      }
+      else if (operation == 3) {
+        int value = values(engine);
+        queue.update(handle, value);
+        expected.emplace(value, handle);
+      }
+      else {
+        queue.erase(handle);
+        handles[idx] = handles.back();
+        handles.pop_back();
+      }
+    }
+    BOOST_REQUIRE_EQUAL(queue.getSize(), expected.size());
+    if (!expected.empty())
+      BOOST_REQUIRE_EQUAL(queue.top(), expected.begin()->first);
+  }
+
+  std::vector<int> popped = popAll(queue);
+  std::vector<int> sorted;
+  for (const auto& entry : expected)
+    sorted.push_back(entry.first);
+  BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), sorted.begin(), sorted.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,206 @@
+#include <SoAVector.h>
+
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using Records = aisdi::SoAVector<std::int32_t, double, std::string>;
+using Record = Records::value_type;
+
+BOOST_AUTO_TEST_SUITE(SoAVectorTests)
+
+void thenCollectionContainsIds(const Records& collection, std::initializer_list<int> expected)
+{
+  auto ids = collection.column<0>();
+  BOOST_CHECK_EQUAL_COLLECTIONS(ids.begin(), ids.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(collection.getSize(), expected.size());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const Records collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK_EQUAL(collection.column<1>().getSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenAppending_ThenEveryColumnHoldsItsField)
+{
+  Records collection;
+
+  collection.append(Record{1, 1.5, "one"});
+  collection.append(Record{2, 2.5, "two"});
+
+  thenCollectionContainsIds(collection, { 1, 2 });
+  BOOST_CHECK_EQUAL(collection.column<1>()[1], 2.5);
+  BOOST_CHECK_EQUAL(collection.column<2>()[0], "one");
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenPrependingAndInserting_ThenColumnsStayInSync)
+{
+  Records collection = { Record{2, 2.0, "b"}, Record{4, 4.0, "d"} };
+
+  collection.prepend(Record{1, 1.0, "a"});
+  collection.insert(collection.begin() + 2, Record{3, 3.0, "c"});
+
+  thenCollectionContainsIds(collection, { 1, 2, 3, 4 });
+  for (const auto& record : collection)
+    BOOST_CHECK_EQUAL(std::get<1>(record), std::get<0>(record));
+  BOOST_CHECK_EQUAL(collection.column<2>()[2], "c");
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenErasing_ThenColumnsStayInSync)
+{
+  Records collection = { Record{1, 1.0, "a"}, Record{2, 2.0, "b"}, Record{3, 3.0, "c"},
+                         Record{4, 4.0, "d"}, Record{5, 5.0, "e"} };
+
+  collection.erase(collection.begin() + 1);
+  collection.erase(collection.begin() + 1, collection.begin() + 3);
+
+  thenCollectionContainsIds(collection, { 1, 5 });
+  BOOST_CHECK_EQUAL(collection.column<2>()[1], "e");
+  BOOST_CHECK_EQUAL(collection.column<1>()[1], 5.0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenErasingEmptyRange_ThenNothingHappens)
+{
+  Records collection = { Record{1, 1.0, "a"}, Record{2, 2.0, "b"}, Record{3, 3.0, "c"} };
+
+  collection.erase(collection.begin() + 1, collection.begin() + 1);
+
+  thenCollectionContainsIds(collection, { 1, 2, 3 });
+  BOOST_CHECK_EQUAL(collection.column<2>()[1], "b");
+  BOOST_CHECK_EQUAL(collection.column<2>()[2], "c");
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenErasingReversedRange_ThenExceptionIsThrown)
+{
+  Records collection = { Record{1, 1.0, "a"}, Record{2, 2.0, "b"} };
+
+  BOOST_CHECK_THROW(collection.erase(collection.begin() + 1, collection.begin()), std::out_of_range);
+  thenCollectionContainsIds(collection, { 1, 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenErasingEnd_ThenExceptionIsThrown)
+{
+  Records collection = { Record{1, 1.0, "a"} };
+
+  BOOST_CHECK_THROW(collection.erase(collection.end()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenPopping_ThenWholeRecordsAreReturned)
+{
+  Records collection = { Record{1, 1.0, "a"}, Record{2, 2.0, "b"}, Record{3, 3.0, "c"} };
+
+  BOOST_CHECK(collection.popFirst() == Record(1, 1.0, "a"));
+  BOOST_CHECK(collection.popLast() == Record(3, 3.0, "c"));
+  thenCollectionContainsIds(collection, { 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPopping_ThenExceptionIsThrown)
+{
+  Records collection;
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::out_of_range);
+  BOOST_CHECK_THROW(collection.popLast(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIterator_WhenWritingThroughProxy_ThenFieldIsChanged)
+{
+  Records collection = { Record{1, 1.0, "a"}, Record{2, 2.0, "b"} };
+
+  auto it = collection.begin();
+  ++it;
+  std::get<2>(*it) = "z";
+  *collection.begin() = Record{7, 7.0, "y"};
+
+  BOOST_CHECK_EQUAL(collection.column<2>()[1], "z");
+  thenCollectionContainsIds(collection, { 7, 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenEndIterator_WhenDereferencingOrIncrementing_ThenOperationThrows)
+{
+  Records collection = { Record{1, 1.0, "a"} };
+
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+  BOOST_CHECK_THROW(collection.cend()++, std::out_of_range);
+  BOOST_CHECK_THROW(collection.begin()--, std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenColumn_WhenWritingThroughSpan_ThenIteratorsSeeTheChange)
+{
+  Records collection = { Record{1, 1.0, "a"}, Record{2, 2.0, "b"} };
+
+  for (double& price : collection.column<1>())
+    price *= 10;
+
+  BOOST_CHECK_EQUAL(std::get<1>(*(collection.cbegin() + 1)), 20.0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyAppends_WhenColumnsGrow_ThenAllFieldsAreKept)
+{
+  aisdi::SoAVector<std::int64_t, std::int8_t> collection;
+
+  for (int i = 0; i < 1000; ++i)
+    collection.append(std::make_tuple(i, static_cast<std::int8_t>(i % 100)));
+
+  auto ids = collection.column<0>();
+  BOOST_CHECK_EQUAL(std::accumulate(ids.begin(), ids.end(), std::int64_t(0)), 999 * 1000 / 2);
+  BOOST_CHECK_EQUAL(collection.column<1>()[999], 99);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRangeOfRecords_WhenConstructing_ThenCollectionContainsThem)
+{
+  const std::vector<Record> source = { Record{3, 3.0, "c"}, Record{4, 4.0, "d"} };
+
+  Records collection(source.begin(), source.end());
+  Records fromIterators(collection.cbegin(), collection.cend());
+
+  thenCollectionContainsIds(collection, { 3, 4 });
+  thenCollectionContainsIds(fromIterators, { 3, 4 });
+  BOOST_CHECK_EQUAL(fromIterators.column<2>()[1], "d");
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopying_ThenCopyIsIndependent)
+{
+  Records collection = { Record{1, 1.0, "a"}, Record{2, 2.0, "b"} };
+  Records other;
+  for (int i = 0; i < 40; ++i)
+    other.append(Record{i, 0.0, ""});
+
+  Records copy{collection};
+  other = collection;
+  collection.column<2>()[0] = "changed";
+
+  thenCollectionContainsIds(copy, { 1, 2 });
+  thenCollectionContainsIds(other, { 1, 2 });
+  BOOST_CHECK_EQUAL(copy.column<2>()[0], "a");
+  BOOST_CHECK_EQUAL(other.column<2>()[0], "a");
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenMoving_ThenSourceIsEmptyAndUsable)
+{
+  Records collection = { Record{1, 1.0, "a"}, Record{2, 2.0, "b"} };
+  Records other = { Record{9, 9.0, "i"} };
+
+  Records moved{std::move(collection)};
+  other = std::move(moved);
+  collection.append(Record{3, 3.0, "c"});
+
+  thenCollectionContainsIds(other, { 1, 2 });
+  thenCollectionContainsIds(collection, { 3 });
+}
+
+// ConstIterator is tested via Iterator methods.
+// If Iterator methods are to be changed, then new ConstIterator tests are required.
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,207 @@
+#include <Sort.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using RadixTypes = boost::mpl::list<std::int8_t, std::uint16_t, std::int32_t, std::uint32_t,
+                                    std::int64_t, std::uint64_t, float, double>;
+
+template <typename T>
+using Vector = aisdi::Vector<T>;
+
+BOOST_AUTO_TEST_SUITE(SortTests)
+
+// Large enough for several threads, see MIN_ELEMENTS_PER_THREAD.
+const std::size_t PARALLEL_COUNT = 200000;
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, std::vector<T>>::type randomValues(std::size_t count)
+{
+  std::default_random_engine engine(static_cast<unsigned>(count));
+  using Wide = typename std::conditional<std::is_signed<T>::value, std::int64_t, std::uint64_t>::type;
+  std::uniform_int_distribution<Wide> distribution(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+  std::vector<T> values;
+  for (std::size_t i = 0; i < count; ++i)
+    values.push_back(static_cast<T>(distribution(engine)));
+  return values;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, std::vector<T>>::type randomValues(std::size_t count)
+{
+  std::default_random_engine engine(static_cast<unsigned>(count));
+  std::uniform_real_distribution<T> distribution(-1e6, 1e6);
+  std::vector<T> values;
+  for (std::size_t i = 0; i < count; ++i)
+    values.push_back(distribution(engine));
+  return values;
+}
+
+template <typename T>
+void thenVectorIsSorted(const Vector<T>& collection, std::vector<T> input)
+{
+  std::sort(input.begin(), input.end());
+  BOOST_REQUIRE_EQUAL(collection.getSize(), input.size());
+  BOOST_CHECK(std::equal(input.begin(), input.end(), collection.data()));
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyAndSingleElementVectors_WhenSorting_ThenNothingChanges)
+{
+  Vector<int> empty;
+  Vector<int> single = { 7 };
+
+  aisdi::sort(empty);
+  aisdi::sort(single);
+
+  BOOST_CHECK(empty.isEmpty());
+  BOOST_CHECK_EQUAL(single.data()[0], 7);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSmallVector_WhenSorting_ThenItIsSorted,
+                              T,
+                              RadixTypes)
+{
+  const std::vector<T> input = randomValues<T>(100);
+  Vector<T> collection(input.begin(), input.end());
+
+  aisdi::sort(collection);
+
+  thenVectorIsSorted(collection, input);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenLargeVector_WhenRadixSortingOnOneThread_ThenItIsSorted,
+                              T,
+                              RadixTypes)
+{
+  const std::vector<T> input = randomValues<T>(5000);
+  Vector<T> collection(input.begin(), input.end());
+  aisdi::SortOptions options;
+  options.threads = 1;
+
+  aisdi::sort(collection, options);
+
+  thenVectorIsSorted(collection, input);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenLargeVector_WhenRadixSortingOnSeveralThreads_ThenItIsSorted,
+                              T,
+                              RadixTypes)
+{
+  const std::vector<T> input = randomValues<T>(PARALLEL_COUNT);
+  Vector<T> collection(input.begin(), input.end());
+  aisdi::SortOptions options;
+  options.threads = 4;
+
+  aisdi::sort(collection, options);
+
+  thenVectorIsSorted(collection, input);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSpecialFloatingPointValues_WhenSorting_ThenTheyAreOrdered)
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  std::vector<double> input = { 3.5, -inf, -0.5, 0.0, inf, -1e300, 1e-300, -2.0 };
+  for (std::size_t i = 0; i < 2000; ++i)
+    input.push_back(static_cast<double>(i % 7) - 3.0);
+  Vector<double> collection(input.begin(), input.end());
+
+  aisdi::sort(collection);
+
+  thenVectorIsSorted(collection, input);
+}
+
+BOOST_AUTO_TEST_CASE(GivenKeysDifferingInHighBytesOnly_WhenSorting_ThenSkippedPassesKeepOrder)
+{
+  std::vector<std::uint64_t> input;
+  for (std::uint64_t i = 0; i < 3000; ++i)
+    input.push_back(((i * 7919) % 3000) << 40);
+  Vector<std::uint64_t> collection(input.begin(), input.end());
+
+  aisdi::sort(collection);
+
+  thenVectorIsSorted(collection, input);
+}
+
+BOOST_AUTO_TEST_CASE(GivenStrings_WhenSortingOnUnevenThreadCount_ThenSlicesAreMerged)
+{
+  std::vector<std::string> input;
+  for (int value : randomValues<std::int32_t>(PARALLEL_COUNT))
+    input.push_back(std::to_string(value));
+  Vector<std::string> collection(input.begin(), input.end());
+  aisdi::SortOptions options;
+  options.threads = 3;
+
+  aisdi::sort(collection, options);
+
+  thenVectorIsSorted(collection, input);
+}
+
+BOOST_AUTO_TEST_CASE(GivenComparator_WhenSorting_ThenItDefinesTheOrder)
+{
+  const std::vector<int> input = randomValues<std::int32_t>(PARALLEL_COUNT);
+  Vector<int> collection(input.begin(), input.end());
+  aisdi::SortOptions options;
+  options.threads = 4;
+
+  aisdi::sort(collection, std::greater<int>(), options);
+
+  std::vector<int> expected = input;
+  std::sort(expected.begin(), expected.end(), std::greater<int>());
+  BOOST_CHECK(std::equal(expected.begin(), expected.end(), collection.data()));
+}
+
+BOOST_AUTO_TEST_CASE(GivenStableOption_WhenSortingByKey_ThenEqualKeysKeepInputOrder)
+{
+  using Entry = std::pair<int, std::size_t>;
+  std::default_random_engine engine(3);
+  std::uniform_int_distribution<int> distribution(0, 99);
+  Vector<Entry> collection;
+  for (std::size_t i = 0; i < PARALLEL_COUNT; ++i)
+    collection.append(Entry(distribution(engine), i));
+  aisdi::SortOptions options;
+  options.stable = true;
+  options.threads = 5;
+
+  aisdi::sort(collection, [](const Entry& left, const Entry& right) { return left.first < right.first; },
+              options);
+
+  const Entry* data = collection.data();
+  for (std::size_t i = 1; i < collection.getSize(); ++i) {
+    BOOST_REQUIRE_LE(data[i - 1].first, data[i].first);
+    if (data[i - 1].first == data[i].first)
+      BOOST_REQUIRE_LT(data[i - 1].second, data[i].second);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenThrowingComparator_WhenSortingInParallel_ThenExceptionReachesCaller)
+{
+  const std::vector<int> input = randomValues<std::int32_t>(PARALLEL_COUNT);
+  Vector<int> collection(input.begin(), input.end());
+  std::atomic<std::size_t> calls(0);
+  aisdi::SortOptions options;
+  options.threads = 4;
+
+  auto compare = [&calls](int left, int right) {
+    if (calls.fetch_add(1) == 100000)
+      throw std::runtime_error("comparison failed");
+    return left < right;
+  };
+
+  BOOST_CHECK_THROW(aisdi::sort(collection, compare, options), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
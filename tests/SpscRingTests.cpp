@@ -0,0 +1,141 @@
+#include <SpscRing.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+BOOST_AUTO_TEST_SUITE(SpscRingTests)
+
+BOOST_AUTO_TEST_CASE(GivenNewRing_WhenPopping_ThenItIsEmpty)
+{
+  aisdi::SpscRing<int, 4> ring;
+  int item = 0;
+
+  BOOST_CHECK(ring.isEmpty());
+  BOOST_CHECK_EQUAL(ring.getCapacity(), 4);
+  BOOST_CHECK(!ring.tryPop(item));
+  BOOST_CHECK_EQUAL(ring.popN(&item, 1), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRing_WhenPushingBeyondCapacity_ThenPushFailsAndItemIsKept)
+{
+  aisdi::SpscRing<std::unique_ptr<int>, 2> ring;
+  std::unique_ptr<int> last(new int(3));
+
+  BOOST_CHECK(ring.tryPush(std::unique_ptr<int>(new int(1))));
+  BOOST_CHECK(ring.tryPush(std::unique_ptr<int>(new int(2))));
+  BOOST_CHECK(!ring.tryPush(std::move(last)));
+
+  BOOST_REQUIRE(last != nullptr);
+  BOOST_CHECK_EQUAL(ring.getSize(), 2);
+  std::unique_ptr<int> item;
+  BOOST_CHECK(ring.tryPop(item));
+  BOOST_CHECK_EQUAL(*item, 1);
+  BOOST_CHECK(ring.tryPush(std::move(last)));
+}
+
+BOOST_AUTO_TEST_CASE(GivenRing_WhenPushingAndPoppingRepeatedly_ThenOrderSurvivesWrapping)
+{
+  aisdi::SpscRing<std::string, 4> ring;
+  int next = 0;
+  int expected = 0;
+
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 3; ++i)
+      BOOST_REQUIRE(ring.tryPush(std::to_string(next++)));
+    std::string item;
+    for (int i = 0; i < 3; ++i) {
+      BOOST_REQUIRE(ring.tryPop(item));
+      BOOST_REQUIRE_EQUAL(item, std::to_string(expected++));
+    }
+  }
+  BOOST_CHECK(ring.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenWrappedRing_WhenPushingAndPoppingBatches_ThenBothSpansAreUsed)
+{
+  aisdi::SpscRing<int, 8> ring;
+  std::vector<int> input(20);
+  std::iota(input.begin(), input.end(), 0);
+  std::vector<int> output;
+
+  BOOST_CHECK_EQUAL(ring.pushN(input.begin(), 6), 6);
+  BOOST_CHECK_EQUAL(ring.popN(std::back_inserter(output), 5), 5);
+  BOOST_CHECK_EQUAL(ring.pushN(input.begin() + 6, 14), 7);
+  BOOST_CHECK_EQUAL(ring.pushN(input.begin() + 13, 7), 0);
+  BOOST_CHECK_EQUAL(ring.popN(std::back_inserter(output), 100), 8);
+
+  const std::vector<int> expected(input.begin(), input.begin() + 13);
+  BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenMoveIterator_WhenPushingBatch_ThenItemsAreMoved)
+{
+  aisdi::SpscRing<std::unique_ptr<int>, 4> ring;
+  std::vector<std::unique_ptr<int>> input;
+  input.emplace_back(new int(1));
+  input.emplace_back(new int(2));
+
+  BOOST_CHECK_EQUAL(ring.pushN(std::make_move_iterator(input.begin()), input.size()), 2);
+
+  BOOST_CHECK(input[0] == nullptr);
+  std::vector<std::unique_ptr<int>> output(2);
+  BOOST_CHECK_EQUAL(ring.popN(output.begin(), 2), 2);
+  BOOST_CHECK_EQUAL(*output[1], 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTwoThreads_WhenTransferringMixedBatches_ThenSequenceArrivesIntact)
+{
+  const std::uint64_t count = 200000;
+  aisdi::SpscRing<std::uint64_t, 64> ring;
+
+  std::thread producer([&ring, count] {
+    std::uint64_t next = 0;
+    std::vector<std::uint64_t> batch(37);
+    while (next < count) {
+      if (next % 3 == 0) {
+        if (!ring.tryPush(next)) {
+          std::this_thread::yield();
+          continue;
+        }
+        ++next;
+        continue;
+      }
+      std::size_t size = static_cast<std::size_t>(std::min<std::uint64_t>(batch.size(), count - next));
+      std::iota(batch.begin(), batch.begin() + size, next);
+      std::size_t pushed = ring.pushN(batch.begin(), size);
+      if (pushed == 0)
+        std::this_thread::yield();
+      next += pushed;
+    }
+  });
+
+  std::uint64_t expected = 0;
+  bool ordered = true;
+  std::vector<std::uint64_t> batch(23);
+  while (expected < count) {
+    std::size_t popped = 0;
+    if (expected % 2 == 0)
+      popped = ring.tryPop(batch[0]) ? 1 : 0;
+    else
+      popped = ring.popN(batch.begin(), batch.size());
+    if (popped == 0)
+      std::this_thread::yield();
+    for (std::size_t i = 0; i < popped; ++i, ++expected)
+      ordered = ordered && batch[i] == expected;
+  }
+  producer.join();
+
+  BOOST_CHECK(ordered);
+  BOOST_CHECK(ring.isEmpty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
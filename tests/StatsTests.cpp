@@ -0,0 +1,72 @@
+#include <LinkedList.h>
+#include <Vector.h>
+
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#if AISDI_LINEAR_STATS
+
+BOOST_AUTO_TEST_SUITE(StatsTests)
+
+BOOST_AUTO_TEST_CASE(GivenVector_WhenInsertingAtBothEndsAndInTheMiddle_ThenEachKindIsCounted)
+{
+  aisdi::Vector<std::int32_t> collection = { 1, 2, 3 };
+
+  collection.append(4);
+  collection.prepend(0);
+  collection.insert(collection.begin() + 2, 10);
+
+  BOOST_CHECK_EQUAL(collection.stats().appends, 1);
+  BOOST_CHECK_EQUAL(collection.stats().prepends, 1);
+  BOOST_CHECK_EQUAL(collection.stats().middleInserts, 1);
+  BOOST_CHECK_EQUAL(collection.stats().elementsShifted, 0 + 4 + 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenVector_WhenErasing_ThenShiftedElementsAreCounted)
+{
+  aisdi::Vector<std::int32_t> collection = { 1, 2, 3, 4, 5 };
+
+  collection.erase(collection.begin() + 1);
+  collection.erase(collection.begin(), collection.begin() + 2);
+
+  BOOST_CHECK_EQUAL(collection.stats().erases, 3);
+  BOOST_CHECK_EQUAL(collection.stats().elementsShifted, 3 + 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullVector_WhenAppending_ThenRealocationAndCopiedBytesAreCounted)
+{
+  aisdi::Vector<std::int32_t> collection;
+  for (int i = 0; i < 17; ++i)
+    collection.append(i);
+
+  // The first append allocates the initial buffer, the 17th grows it.
+  BOOST_CHECK_EQUAL(collection.stats().realocations, 2);
+  BOOST_CHECK_EQUAL(collection.stats().bytesCopied, 16 * sizeof(std::int32_t));
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenAdvancingIterator_ThenStepsAreCounted)
+{
+  aisdi::LinkedList<std::int32_t> collection = { 1, 2, 3, 4, 5 };
+  collection.resetStats();
+
+  auto it = collection.begin() + 3;
+  collection.insert(it - 2, 7);
+
+  BOOST_CHECK_EQUAL(collection.stats().iteratorSteps, 5);
+  BOOST_CHECK_EQUAL(collection.stats().middleInserts, 1);
+  BOOST_CHECK_EQUAL(collection.stats().appends, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCountedVector_WhenDumpingJson_ThenCountersAreIncluded)
+{
+  aisdi::Vector<std::int32_t> collection;
+  collection.append(1);
+
+  BOOST_CHECK(collection.statsJson().find("\"appends\": 1") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -3,6 +3,10 @@
 #include <initializer_list>
 #include <complex>
 #include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/test_tools.hpp>
@@ -10,6 +14,8 @@
 #include <boost/mpl/list.hpp>
 
 using TestedTypes = boost::mpl::list<std::int32_t, std::uint64_t, std::complex<std::int32_t>>;
+// Non-trivial items expose moves that clobber elements still in the collection.
+using ErasedTypes = boost::mpl::list<std::int32_t, std::uint64_t, std::complex<std::int32_t>, std::string>;
 
 template <typename T>
 using LinearCollection = aisdi::Vector<T>;
@@ -19,6 +25,38 @@ using std::end;
 
 BOOST_AUTO_TEST_SUITE(VectorTests)
 
+template <typename T>
+T makeItem(int value)
+{
+  return T(value);
+}
+
+template <>
+std::string makeItem<std::string>(int value)
+{
+  return std::to_string(value);
+}
+
+template <typename T>
+LinearCollection<T> makeCollection(std::initializer_list<int> values)
+{
+  LinearCollection<T> collection;
+  for (int value : values)
+    collection.append(makeItem<T>(value));
+  return collection;
+}
+
+template <typename T>
+void thenCollectionContainsItems(const LinearCollection<T>& collection,
+                                 std::initializer_list<int> expected)
+{
+  std::vector<T> items;
+  for (int value : expected)
+    items.push_back(makeItem<T>(value));
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection),
+                                begin(items), end(items));
+}
+
 template <typename T>
 void thenCollectionContainsValues(const LinearCollection<T>& collection,
                                   std::initializer_list<int> expected)
@@ -652,13 +690,14 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithSingleItem_WhenErasing_ThenColl
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingEmptyRange_ThenNothingHappens,
                               T,
-                              TestedTypes)
+                              ErasedTypes)
 {
-  LinearCollection<T> collection = { 19, 42, 11 };
+  LinearCollection<T> collection = makeCollection<T>({ 19, 42, 11 });
 
   collection.erase(begin(collection), begin(collection));
+  collection.erase(begin(collection) + 1, begin(collection) + 1);
 
-  thenCollectionContainsValues(collection, { 19, 42, 11 });
+  thenCollectionContainsItems(collection, { 19, 42, 11 });
 }
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingRangeFromBegin_ThenItemsAreRemoved,
@@ -716,6 +755,113 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingRange_ThenSizeI
   BOOST_CHECK_EQUAL(collection.getSize(), 2);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenRange_WhenCreatingCollection_ThenItContainsRangeItems,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> items = { 1410, 753, 1789 };
+
+  LinearCollection<T> collection(items.begin(), items.end());
+
+  thenCollectionContainsValues(collection, { 1410, 753, 1789 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyRange_WhenCreatingCollection_ThenItIsEmptyAndCanGrow,
+                              T,
+                              TestedTypes)
+{
+  const std::vector<T> items;
+
+  LinearCollection<T> collection(items.begin(), items.end());
+  BOOST_CHECK(collection.isEmpty());
+
+  collection.append(42);
+  thenCollectionContainsValues(collection, { 42 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenAssigningShorterRange_ThenOnlyRangeItemsRemain,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3, 4, 5 };
+  const std::vector<T> items = { 10, 20 };
+
+  collection.assign(items.begin(), items.end());
+
+  thenCollectionContainsValues(collection, { 10, 20 });
+  BOOST_CHECK_EQUAL(collection.getSize(), 2);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenAssigningLongerRange_ThenOnlyRangeItemsRemain,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2 };
+  std::vector<T> items;
+  for (int i = 0; i < 40; ++i)
+    items.push_back(i);
+
+  collection.assign(items.begin(), items.end());
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 40);
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection), items.begin(), items.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenInputIteratorRange_WhenCreatingCollection_ThenItContainsReadItems)
+{
+  std::istringstream in("3 1 4 1 5");
+
+  LinearCollection<int> collection{std::istream_iterator<int>(in), std::istream_iterator<int>()};
+
+  thenCollectionContainsValues(collection, { 3, 1, 4, 1, 5 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenLongerCollection_WhenAssigningToShorter_ThenSizeIsCopied,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  for (int i = 0; i < 100; ++i)
+    collection.append(i);
+  LinearCollection<T> other = { 1, 2, 3 };
+
+  collection = other;
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 3);
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenMovedFromCollection_WhenAppending_ThenItIsUsableAgain,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+  LinearCollection<T> other{std::move(collection)};
+
+  collection.append(4);
+  collection.prepend(5);
+
+  thenCollectionContainsValues(collection, { 5, 4 });
+  thenCollectionContainsValues(other, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenReservedCollection_WhenAppending_ThenDataStaysInPlace,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1 };
+
+  collection.reserve(100);
+  const T* data = collection.data();
+  for (int i = 2; i <= 100; ++i)
+    collection.append(i);
+
+  BOOST_CHECK(collection.data() == data);
+  BOOST_CHECK_EQUAL(collection.getSize(), 100);
+  BOOST_CHECK(collection.data()[99] == T(100));
+  BOOST_CHECK(*(collection.begin() + 50) == collection.data()[50]);
+}
+
 // ConstIterator is tested via Iterator methods.
 // If Iterator methods are to be changed, then new ConstIterator tests are required.
 
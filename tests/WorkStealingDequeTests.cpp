@@ -0,0 +1,174 @@
+#include <WorkStealingDeque.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using Deque = aisdi::WorkStealingDeque<std::int32_t>;
+
+BOOST_AUTO_TEST_SUITE(WorkStealingDequeTests)
+
+BOOST_AUTO_TEST_CASE(GivenZeroCapacity_WhenCreatingDeque_ThenExceptionIsThrown)
+{
+  BOOST_CHECK_THROW(Deque(0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCapacity_WhenCreatingDeque_ThenItIsRoundedToPowerOfTwo)
+{
+  Deque deque(100);
+
+  BOOST_CHECK_EQUAL(deque.getCapacity(), 128);
+  BOOST_CHECK(deque.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyDeque_WhenPoppingOrStealing_ThenNothingIsTaken)
+{
+  Deque deque;
+  std::int32_t item = 0;
+
+  BOOST_CHECK(!deque.pop(item));
+  BOOST_CHECK(!deque.steal(item));
+  BOOST_CHECK(deque.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenDeque_WhenOwnerPops_ThenNewestComesFirst)
+{
+  Deque deque;
+  for (std::int32_t i = 1; i <= 3; ++i)
+    deque.push(i);
+  std::int32_t item = 0;
+
+  BOOST_CHECK(deque.pop(item));
+  BOOST_CHECK_EQUAL(item, 3);
+  BOOST_CHECK(deque.pop(item));
+  BOOST_CHECK_EQUAL(item, 2);
+  BOOST_CHECK_EQUAL(deque.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenDeque_WhenStealing_ThenOldestComesFirst)
+{
+  Deque deque;
+  for (std::int32_t i = 1; i <= 3; ++i)
+    deque.push(i);
+  std::int32_t item = 0;
+
+  BOOST_CHECK(deque.steal(item));
+  BOOST_CHECK_EQUAL(item, 1);
+  BOOST_CHECK(deque.pop(item));
+  BOOST_CHECK_EQUAL(item, 3);
+  BOOST_CHECK(deque.steal(item));
+  BOOST_CHECK_EQUAL(item, 2);
+  BOOST_CHECK(!deque.pop(item));
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullDeque_WhenPushingAfterSteals_ThenGrowingKeepsOrder)
+{
+  Deque deque(4);
+  std::int32_t item = 0;
+  for (std::int32_t i = 0; i < 4; ++i)
+    deque.push(i);
+  deque.steal(item);
+  deque.steal(item);
+
+  for (std::int32_t i = 4; i < 20; ++i)
+    deque.push(i);
+
+  BOOST_CHECK_GE(deque.getCapacity(), 18);
+  BOOST_CHECK_EQUAL(deque.getSize(), 18);
+  for (std::int32_t expected = 2; expected < 20; ++expected) {
+    BOOST_REQUIRE(deque.steal(item));
+    BOOST_REQUIRE_EQUAL(item, expected);
+  }
+  BOOST_CHECK(deque.isEmpty());
+}
+
+// Every pushed value must be taken exactly once, by the owner or by one of the thieves.
+void thenEveryValueWasTakenOnce(const std::vector<std::atomic<int>>& taken)
+{
+  std::size_t wrong = 0;
+  for (const auto& count : taken)
+    wrong += count.load() != 1;
+  BOOST_CHECK_EQUAL(wrong, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenThieves_WhenOwnerPushesAndPops_ThenEveryValueIsTakenOnce)
+{
+  const std::int32_t count = 200000;
+  Deque deque(8);
+  std::vector<std::atomic<int>> taken(count);
+  for (auto& value : taken)
+    value = 0;
+  std::atomic<bool> done(false);
+
+  std::vector<std::thread> thieves;
+  for (int thief = 0; thief < 3; ++thief) {
+    thieves.emplace_back([&] {
+      std::int32_t item = 0;
+      while (!done.load()) {
+        if (deque.steal(item))
+          taken[item].fetch_add(1);
+        else
+          std::this_thread::yield();
+      }
+    });
+  }
+
+  std::int32_t item = 0;
+  for (std::int32_t i = 0; i < count; ++i) {
+    deque.push(i);
+    if (i % 3 == 0 && deque.pop(item))
+      taken[item].fetch_add(1);
+  }
+  while (deque.pop(item))
+    taken[item].fetch_add(1);
+  done = true;
+  for (auto& thief : thieves)
+    thief.join();
+
+  BOOST_CHECK(deque.isEmpty());
+  thenEveryValueWasTakenOnce(taken);
+}
+
+BOOST_AUTO_TEST_CASE(GivenThieves_WhenOwnerRacesForLastElements_ThenNoValueIsLostOrDuplicated)
+{
+  const int rounds = 20000;
+  Deque deque(2);
+  std::vector<std::atomic<int>> taken(2 * rounds);
+  for (auto& value : taken)
+    value = 0;
+  std::atomic<bool> done(false);
+
+  std::vector<std::thread> thieves;
+  for (int thief = 0; thief < 2; ++thief) {
+    thieves.emplace_back([&] {
+      std::int32_t item = 0;
+      while (!done.load()) {
+        if (deque.steal(item))
+          taken[item].fetch_add(1);
+      }
+    });
+  }
+
+  std::int32_t item = 0;
+  for (int round = 0; round < rounds; ++round) {
+    deque.push(2 * round);
+    deque.push(2 * round + 1);
+    while (deque.pop(item))
+      taken[item].fetch_add(1);
+    while (!deque.isEmpty())
+      std::this_thread::yield();
+  }
+  done = true;
+  for (auto& thief : thieves)
+    thief.join();
+
+  thenEveryValueWasTakenOnce(taken);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -4,3 +4,4 @@
 #define BOOST_TEST_MAIN
 #define BOOST_TEST_MODULE aisdi_linear_tests
 #include <boost/test/unit_test.hpp>
+#include <AllocationHooks.h>